@@ -91,6 +91,12 @@ private:
   su2double* SubsonicEngine_Cyl; /*!< \brief Coordinates of the box subsonic region */
   su2double* SubsonicEngine_Values; /*!< \brief Values of the box subsonic region */
   su2double* Hold_GridFixed_Coord; /*!< \brief Coordinates of the box to hold fixed the nbumerical grid */
+  su2double *Output_Filter_Box;    /*!< \brief Coordinates of the box of the points written to the parallel volume files (Xmin, Ymin, Zmin, Xmax, Ymax, Zmax). */
+  su2double *Output_Filter_WallDist; /*!< \brief Wall distance band of the points written to the parallel volume files (min, max). */
+  unsigned long Output_Filter_Stride; /*!< \brief Write only every Nth point (by global index) to the parallel volume files. */
+  unsigned short nMarker_Output_Filter; /*!< \brief Number of markers whose points are written to the parallel volume files. */
+  string *Marker_Output_Filter;    /*!< \brief Markers whose points are written to the parallel volume files. */
+  bool Output_Filter;              /*!< \brief True if any of the output filters is active. */
   su2double *DistortionRack;
   su2double *PressureLimits,
   *DensityLimits,
@@ -105,6 +111,7 @@ private:
   su2double FFD_Tol;  	/*!< \brief Tolerance in the point inversion problem. */
   su2double FFD_Scale;  	/*!< \brief Scale factor between the design variable value and the control point movement. */
   bool Viscous_Limiter_Flow, Viscous_Limiter_Turb;			/*!< \brief Viscous limiters. */
+  bool Edge_Coloring;			/*!< \brief Group the edges in conflict-free colors for shared-memory parallelism. */
   bool Write_Conv_FSI;			/*!< \brief Write convergence file for FSI problems. */
   bool ContinuousAdjoint,			/*!< \brief Flag to know if the code is solving an adjoint problem. */
   Viscous,                /*!< \brief Flag to know if the code is solving a viscous problem. */
@@ -131,6 +138,8 @@ private:
   su2double Damp_Engine_Exhaust;	/*!< \brief Damping factor for the engine exhaust. */
   su2double Damp_Res_Restric,	/*!< \brief Damping factor for the residual restriction. */
   Damp_Correc_Prolong; /*!< \brief Damping factor for the correction prolongation. */
+  bool MG_Agglomeration_Cache; /*!< \brief Flag to store/reuse the multigrid agglomeration on disk. */
+  string MG_Cache_FileName; /*!< \brief Root name of the multigrid agglomeration cache files. */
   su2double Position_Plane; /*!< \brief Position of the Near-Field (y coordinate 2D, and z coordinate 3D). */
   su2double WeightCd; /*!< \brief Weight of the drag coefficient. */
   su2double dCD_dCL; /*!< \brief Weight of the drag coefficient. */
@@ -352,6 +361,8 @@ private:
   unsigned long Dyn_nIntIter;			/*!< \brief Number of internal iterations (Newton-Raphson Method for nonlinear structural analysis). */
   long Unst_RestartIter;			/*!< \brief Iteration number to restart an unsteady simulation (Dual time Method). */
   long Unst_AdjointIter;			/*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
+  unsigned short Unst_Adjoint_Checkpoints;	/*!< \brief Number of direct time levels kept in memory by the unsteady discrete adjoint. */
+  bool Unst_Adjoint_Checkpoint_Compress;	/*!< \brief Lossless compression of the direct time levels kept in memory. */
   long Iter_Avg_Objective;			/*!< \brief Iteration the number of time steps to be averaged, counting from the back */
   long Dyn_RestartIter;			/*!< \brief Iteration number to restart a dynamic structural analysis. */
   unsigned short nRKStep;			/*!< \brief Number of steps of the explicit Runge-Kutta method. */
@@ -399,6 +410,8 @@ private:
   Kind_GasModel,				/*!< \brief Kind of the Gas Model. */
   *Kind_GridMovement,    /*!< \brief Kind of the unsteady mesh movement. */
   Kind_Gradient_Method,		/*!< \brief Numerical method for computation of spatial gradients. */
+  Kind_Point_Ordering,		/*!< \brief Renumbering of the points for cache locality. */
+  Kind_Edge_Ordering,		/*!< \brief Renumbering of the edges for cache locality. */
   Kind_Deform_Linear_Solver, /*!< Numerical method to deform the grid */
   Kind_Deform_Linear_Solver_Prec,		/*!< \brief Preconditioner of the linear solver. */
   Kind_Linear_Solver,		/*!< \brief Numerical solver for the implicit scheme. */
@@ -598,6 +611,7 @@ private:
   unsigned short Analytical_Surface;	/*!< \brief Information about the analytical definition of the surface for grid adaptation. */
   unsigned short Axis_Stations;	/*!< \brief Axis orientation. */
   unsigned short Mesh_FileFormat;	/*!< \brief Mesh input format. */
+  unsigned short Mesh_Out_FileFormat;	/*!< \brief Mesh output format. */
   unsigned short Output_FileFormat;	/*!< \brief Format of the output files. */
   unsigned short ActDisk_Jump;	/*!< \brief Format of the output files. */
   bool CFL_Adapt;      /*!< \brief Adaptive CFL number. */
@@ -651,6 +665,9 @@ private:
   Wrt_Vol_Sol,                /*!< \brief Write a volume solution file */
   Wrt_Srf_Sol,                /*!< \brief Write a surface solution file */
   Wrt_Csv_Sol,                /*!< \brief Write a surface comma-separated values solution file */
+  Wrt_Binary_Restart,         /*!< \brief Write the restart file in the SU2 binary format */
+  Read_Binary_Restart,        /*!< \brief Read the restart file in the SU2 binary format */
+  Async_Output,               /*!< \brief Write the merged solution files from a background thread */
   Wrt_Residuals,              /*!< \brief Write residuals to solution file */
   Wrt_Limiters,              /*!< \brief Write residuals to solution file */
   Wrt_SharpEdges,              /*!< \brief Write residuals to solution file */
@@ -825,6 +842,13 @@ private:
   unsigned long Nonphys_Points, /*!< \brief Current number of non-physical points in the solution. */
   Nonphys_Reconstr;           /*!< \brief Current number of non-physical reconstructions for 2nd-order upwinding. */
   bool ParMETIS;              /*!< \brief Boolean for activating ParMETIS mode (while testing). */
+  unsigned short Kind_Partition_Weights; /*!< \brief Kind of vertex weights for the partitioning. */
+  su2double Partition_Weight_Edge,     /*!< \brief Estimated work of each edge of a point, relative to the point itself. */
+  Partition_Weight_Boundary;           /*!< \brief Estimated extra work of a boundary point, relative to an interior point. */
+  string Partition_Weight_FileName;    /*!< \brief File with the measured work of each point. */
+  bool Wrt_Partition_Weights;          /*!< \brief Write the measured work of each point at the end of the run. */
+  unsigned short Kind_History_Stream;  /*!< \brief Format of the history stream file. */
+  unsigned long History_Stream_Batch;  /*!< \brief Number of records buffered before the history stream is flushed. */
   unsigned short DirectDiff;  /*!< \brief Direct Differentation mode. */
   bool DiscreteAdjoint;       /*!< \brief AD-based discrete adjoint mode. */
   su2double *default_vel_inf, /*!< \brief Default freestream velocity array for the COption class. */
@@ -838,6 +862,8 @@ private:
   *default_distortion,        /*!< \brief Default SU2_GEO section locations array for the COption class. */
   *default_ea_lim,            /*!< \brief Default equivalent area limit array for the COption class. */
   *default_grid_fix,          /*!< \brief Default fixed grid (non-deforming region) array for the COption class. */
+  *default_output_box,        /*!< \brief Default output filter box array for the COption class. */
+  *default_output_walldist,   /*!< \brief Default output filter wall distance band for the COption class. */
   *default_htp_axis,          /*!< \brief Default HTP axis for the COption class. */
   *default_ffd_axis,          /*!< \brief Default FFD axis for the COption class. */
   *default_inc_crit;          /*!< \brief Default incremental criteria array for the COption class. */
@@ -2427,6 +2453,18 @@ public:
    */
   long GetUnst_AdjointIter(void);
   
+  /*!
+   * \brief Get the number of direct time levels kept in memory by the unsteady discrete adjoint.
+   * \return Number of restart files whose data is kept in memory (0 disables the store).
+   */
+  unsigned short GetUnst_Adjoint_Checkpoints(void);
+  
+  /*!
+   * \brief Get whether the direct time levels kept in memory are compressed.
+   * \return <code>TRUE</code> if the stored restart data is compressed; otherwise <code>FALSE</code>.
+   */
+  bool GetUnst_Adjoint_Checkpoint_Compress(void);
+  
   /*!
    * \brief Number of iterations to average (reverse time integration).
    * \return Starting direct iteration number for the unsteady adjoint.
@@ -2567,6 +2605,24 @@ public:
    */
   bool GetWrt_Csv_Sol(void);
   
+  /*!
+   * \brief Get information about writing the restart file in the SU2 binary format.
+   * \return <code>TRUE</code> means that the restart file will be written in binary (MPI-IO).
+   */
+  bool GetWrt_Binary_Restart(void);
+  
+  /*!
+   * \brief Get information about reading the restart file in the SU2 binary format.
+   * \return <code>TRUE</code> means that the restart file will be read in binary (MPI-IO).
+   */
+  bool GetRead_Binary_Restart(void);
+  
+  /*!
+   * \brief Get information about writing the solution files asynchronously.
+   * \return <code>TRUE</code> means that the master node writes the merged solution from a background thread.
+   */
+  bool GetAsync_Output(void);
+  
   /*!
    * \brief Get information about writing residuals to volume solution file.
    * \return <code>TRUE</code> means that residuals will be written to the solution file.
@@ -2591,6 +2647,43 @@ public:
    */
   bool GetWrt_Halo(void);
   
+  /*!
+   * \brief Get information about filtering the points of the parallel volume solution files.
+   * \return <code>TRUE</code> means that only the points that pass the output filters are written.
+   */
+  bool GetOutput_Filter(void);
+  
+  /*!
+   * \brief Get the box of the points written to the parallel volume solution files.
+   * \return Coordinates of the box (Xmin, Ymin, Zmin, Xmax, Ymax, Zmax).
+   */
+  su2double *GetOutput_Filter_Box(void);
+  
+  /*!
+   * \brief Get the wall distance band of the points written to the parallel volume solution files.
+   * \return Minimum and maximum wall distance.
+   */
+  su2double *GetOutput_Filter_WallDist(void);
+  
+  /*!
+   * \brief Get the stride of the points written to the parallel volume solution files.
+   * \return Only the points whose global index is a multiple of the stride are written.
+   */
+  unsigned long GetOutput_Filter_Stride(void);
+  
+  /*!
+   * \brief Get the number of markers of the output filter.
+   * \return Number of markers whose points are written to the parallel volume solution files.
+   */
+  unsigned short GetnMarker_Output_Filter(void);
+  
+  /*!
+   * \brief Get the name of a marker of the output filter.
+   * \param[in] val_marker - Index of the marker in the OUTPUT_FILTER_MARKER list.
+   * \return Name of the marker.
+   */
+  string GetMarker_Output_Filter(unsigned short val_marker);
+  
   /*!
    * \brief Get information about writing sectional force files.
    * \return <code>TRUE</code> means that sectional force files will be written for specified markers.
@@ -3081,6 +3174,54 @@ public:
    */
   unsigned short GetKind_Gradient_Method(void);
   
+  /*!
+   * \brief Get the kind of point renumbering applied after the partitioning.
+   * \return Kind of point ordering (see <i>ENUM_POINT_ORDERING</i>).
+   */
+  unsigned short GetKind_Point_Ordering(void);
+  
+  /*!
+   * \brief Get the kind of edge renumbering applied after the edge structure is built.
+   * \return Kind of edge ordering (see <i>ENUM_EDGE_ORDERING</i>).
+   */
+  unsigned short GetKind_Edge_Ordering(void);
+  
+  /*!
+   * \brief Get whether the edges are grouped in conflict-free colors.
+   * \return <code>TRUE</code> if the edge coloring is computed.
+   */
+  bool GetEdge_Coloring(void);
+  
+  /*!
+   * \brief Get the kind of vertex weights used by the graph partitioning.
+   * \return Kind of partition weights (see <i>ENUM_PARTITION_WEIGHTS</i>).
+   */
+  unsigned short GetKind_Partition_Weights(void);
+  
+  /*!
+   * \brief Get the estimated work of each edge of a point, relative to the work of the point.
+   * \return Weight of an edge in the partitioning.
+   */
+  su2double GetPartition_Weight_Edge(void);
+  
+  /*!
+   * \brief Get the estimated extra work of a boundary point, relative to the work of an interior point.
+   * \return Extra weight of a boundary point in the partitioning.
+   */
+  su2double GetPartition_Weight_Boundary(void);
+  
+  /*!
+   * \brief Get the name of the file with the measured work of each point.
+   * \return Name of the partition weights file.
+   */
+  string GetPartition_Weight_FileName(void);
+  
+  /*!
+   * \brief Get whether the measured work of each point is written at the end of the run.
+   * \return <code>TRUE</code> if the partition weights file must be written.
+   */
+  bool GetWrt_Partition_Weights(void);
+  
   /*!
    * \brief Get the kind of solver for the implicit solver.
    * \return Numerical solver for implicit formulation (solving the linear system).
@@ -4131,6 +4272,12 @@ public:
    */
   unsigned short GetMesh_FileFormat(void);
   
+  /*!
+   * \brief Get the format of the output grid.
+   * \return Format of the output grid.
+   */
+  unsigned short GetMesh_Out_FileFormat(void);
+  
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
@@ -4149,6 +4296,18 @@ public:
    */
   string GetConv_FileName(void);
   
+  /*!
+   * \brief Get the format of the history stream file.
+   * \return Format of the history stream (<code>NO_STREAM</code> if it is not written).
+   */
+  unsigned short GetKind_History_Stream(void);
+  
+  /*!
+   * \brief Get the number of records buffered before the history stream is flushed.
+   * \return Number of records of each batch.
+   */
+  unsigned long GetHistory_Stream_Batch(void);
+  
   /*!
    * \brief Get the name of the file with the convergence history of the problem for FSI applications.
    * \return Name of the file with convergence history of the problem.
@@ -4921,6 +5080,18 @@ public:
    */
   su2double GetDamp_Correc_Prolong(void);
   
+  /*!
+   * \brief Get whether the multigrid agglomeration is stored on disk and reused in later runs.
+   * \return <code>TRUE</code> if the agglomeration cache is used; otherwise <code>FALSE</code>.
+   */
+  bool GetMG_Agglomeration_Cache(void);
+  
+  /*!
+   * \brief Get the root name of the multigrid agglomeration cache files.
+   * \return Root name of the cache files.
+   */
+  string GetMG_Cache_FileName(void);
+  
   /*!
    * \brief Value of the position of the Near Field (y coordinate for 2D, and z coordinate for 3D).
    * \return Value of the Near Field position.
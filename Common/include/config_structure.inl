@@ -261,6 +261,10 @@ inline long CConfig::GetUnst_RestartIter(void) { return Unst_RestartIter; }
 
 inline long CConfig::GetUnst_AdjointIter(void) { return Unst_AdjointIter; }
 
+inline unsigned short CConfig::GetUnst_Adjoint_Checkpoints(void) { return Unst_Adjoint_Checkpoints; }
+
+inline bool CConfig::GetUnst_Adjoint_Checkpoint_Compress(void) { return Unst_Adjoint_Checkpoint_Compress; }
+
 inline unsigned long CConfig::GetIter_Avg_Objective(void) { return Iter_Avg_Objective ; }
 
 inline long CConfig::GetDyn_RestartIter(void) { return Dyn_RestartIter; }
@@ -767,6 +771,22 @@ inline su2double CConfig::GetmaxTurkelBeta() { return  Max_Beta_RoeTurkel; }
 
 inline unsigned short CConfig::GetKind_Gradient_Method(void) { return Kind_Gradient_Method; }
 
+inline unsigned short CConfig::GetKind_Point_Ordering(void) { return Kind_Point_Ordering; }
+
+inline unsigned short CConfig::GetKind_Edge_Ordering(void) { return Kind_Edge_Ordering; }
+
+inline bool CConfig::GetEdge_Coloring(void) { return Edge_Coloring; }
+
+inline unsigned short CConfig::GetKind_Partition_Weights(void) { return Kind_Partition_Weights; }
+
+inline su2double CConfig::GetPartition_Weight_Edge(void) { return Partition_Weight_Edge; }
+
+inline su2double CConfig::GetPartition_Weight_Boundary(void) { return Partition_Weight_Boundary; }
+
+inline string CConfig::GetPartition_Weight_FileName(void) { return Partition_Weight_FileName; }
+
+inline bool CConfig::GetWrt_Partition_Weights(void) { return Wrt_Partition_Weights; }
+
 inline unsigned short CConfig::GetKind_Linear_Solver(void) { return Kind_Linear_Solver; }
 
 inline unsigned short CConfig::GetKind_Deform_Linear_Solver(void) { return Kind_Deform_Linear_Solver; }
@@ -1088,12 +1108,18 @@ inline string CConfig::GetMesh_Out_FileName(void) { return Mesh_Out_FileName; }
 
 inline unsigned short CConfig::GetMesh_FileFormat(void) { return Mesh_FileFormat; }
 
+inline unsigned short CConfig::GetMesh_Out_FileFormat(void) { return Mesh_Out_FileFormat; }
+
 inline unsigned short CConfig::GetOutput_FileFormat(void) { return Output_FileFormat; }
 
 inline unsigned short CConfig::GetActDisk_Jump(void) { return ActDisk_Jump; }
 
 inline string CConfig::GetConv_FileName(void) { return Conv_FileName; }
 
+inline unsigned short CConfig::GetKind_History_Stream(void) { return Kind_History_Stream; }
+
+inline unsigned long CConfig::GetHistory_Stream_Batch(void) { return History_Stream_Batch; }
+
 inline string CConfig::GetConv_FileName_FSI(void) { return Conv_FileName_FSI; }
 
 inline string CConfig::GetBreakdown_FileName(void) { return Breakdown_FileName; }
@@ -1192,6 +1218,10 @@ inline su2double CConfig::GetDamp_Res_Restric(void) { return Damp_Res_Restric; }
 
 inline su2double CConfig::GetDamp_Correc_Prolong(void) { return Damp_Correc_Prolong; }
 
+inline bool CConfig::GetMG_Agglomeration_Cache(void) { return MG_Agglomeration_Cache; }
+
+inline string CConfig::GetMG_Cache_FileName(void) { return MG_Cache_FileName; }
+
 inline su2double CConfig::GetPosition_Plane(void) { return Position_Plane; }
 
 inline su2double CConfig::GetWeightCd(void) { return WeightCd; }
@@ -1292,6 +1322,12 @@ inline bool CConfig::GetWrt_Srf_Sol(void) { return Wrt_Srf_Sol; }
 
 inline bool CConfig::GetWrt_Csv_Sol(void) { return Wrt_Csv_Sol; }
 
+inline bool CConfig::GetWrt_Binary_Restart(void) { return Wrt_Binary_Restart; }
+
+inline bool CConfig::GetRead_Binary_Restart(void) { return Read_Binary_Restart; }
+
+inline bool CConfig::GetAsync_Output(void) { return Async_Output; }
+
 inline bool CConfig::GetWrt_Residuals(void) { return Wrt_Residuals; }
 
 inline bool CConfig::GetWrt_Limiters(void) { return Wrt_Limiters; }
@@ -1300,6 +1336,18 @@ inline bool CConfig::GetWrt_SharpEdges(void) { return Wrt_SharpEdges; }
 
 inline bool CConfig::GetWrt_Halo(void) { return Wrt_Halo; }
 
+inline bool CConfig::GetOutput_Filter(void) { return Output_Filter; }
+
+inline su2double* CConfig::GetOutput_Filter_Box(void) { return Output_Filter_Box; }
+
+inline su2double* CConfig::GetOutput_Filter_WallDist(void) { return Output_Filter_WallDist; }
+
+inline unsigned long CConfig::GetOutput_Filter_Stride(void) { return Output_Filter_Stride; }
+
+inline unsigned short CConfig::GetnMarker_Output_Filter(void) { return nMarker_Output_Filter; }
+
+inline string CConfig::GetMarker_Output_Filter(unsigned short val_marker) { return Marker_Output_Filter[val_marker]; }
+
 inline bool CConfig::GetPlot_Section_Forces(void) { return Plot_Section_Forces; }
 
 inline bool CConfig::GetWrt_1D_Output(void) { return Wrt_1D_Output; }
@@ -888,23 +888,25 @@ public:
  */
 class CVertex : public CDualGrid {
 private:
-	unsigned long *Nodes;	/*!< \brief Vector to store the global nodes of an element. */
-	su2double *Normal;			/*!< \brief Normal coordinates of the element and its center of gravity. */
+	unsigned long Nodes[1];	/*!< \brief Vector to store the global nodes of an element. */
+	su2double Normal[3];			/*!< \brief Normal coordinates of the element and its center of gravity. */
 	su2double Aux_Var;			/*!< \brief Auxiliar variable defined only on the surface. */
-	su2double CartCoord[3];		/*!< \brief Vertex cartesians coordinates. */
-	su2double VarCoord[3];		/*!< \brief Used for storing the coordinate variation due to a surface modification. */
+	su2double *CartCoord;		/*!< \brief Vertex cartesians coordinates (allocated when set). */
+	su2double *VarCoord;		/*!< \brief Used for storing the coordinate variation due to a surface modification (allocated when set). */
 	su2double *VarRot;   /*!< \brief Used for storing the rotation variation due to a surface modification. */
-	long PeriodicPoint[5];			/*!< \brief Store the periodic point of a boundary (iProcessor, iPoint) */
+	long *PeriodicPoint;			/*!< \brief Store the periodic point of a boundary (iProcessor, iPoint), allocated when a donor is set. */
   bool ActDisk_Perimeter;     /*!< \brief Identify nodes at the perimeter of the actuator disk */
 	short Rotation_Type;			/*!< \brief Type of rotation associated with the vertex (MPI and periodic) */
+  unsigned short Donor_Face;  /*!<\brief Store the donor face (w/in donor element) for interpolation across zones */
+  unsigned short nDonor_Points; /*!\brief Number of points in Donor_Points; at least there will be one donor point (if the mesh is matching)*/
 	unsigned long Normal_Neighbor; /*!< \brief Index of the closest neighbor. */
 	unsigned long *Donor_Points; /*!< \brief indices of donor points for interpolation across zones */
 	unsigned long *Donor_Proc; /*!< \brief indices of donor processor for interpolation across zones in parallel */
   unsigned long Donor_Elem;   /*!< \brief Store the donor element for interpolation across zones/ */
-  unsigned short Donor_Face;  /*!<\brief Store the donor face (w/in donor element) for interpolation across zones */
-  su2double Basis_Function[3]; /*!< \brief Basis function values for interpolation across zones. */
+  su2double *Basis_Function; /*!< \brief Basis function values for interpolation across zones (allocated when set). */
   su2double *Donor_Coeff; /*!\brief Store a list of coefficients corresponding to the donor points. */
-  unsigned short nDonor_Points; /*!\brief Number of points in Donor_Points; at least there will be one donor point (if the mesh is matching)*/
+  static su2double Zero_Coord[3]; /*!< \brief Returned for the coordinates and their variation if they have not been set. */
+  static long No_PeriodicPoint[5]; /*!< \brief Returned for the periodic point if no donor has been set. */
   
 public:
 
@@ -1116,6 +1118,11 @@ public:
 	 * \return Value of the periodic point of a vertex, and the domain.
 	 */
 	long *GetPeriodicPointDomain(void);	
+
+	/*! 
+	 * \brief Allocate the periodic/donor point information (initialized to -1).
+	 */
+	void AllocatePeriodicPoint(void);
   
   /*!
    * \brief Get the value of the periodic point of a vertex, and its somain
@@ -279,11 +279,11 @@ inline unsigned long CVertex::GetNode() { return Nodes[0]; }
 
 inline su2double *CVertex::GetNormal(void) { return Normal; }
 
-inline su2double *CVertex::GetVarCoord(void) { return VarCoord; }
+inline su2double *CVertex::GetVarCoord(void) { return (VarCoord != NULL)? VarCoord : Zero_Coord; }
 
-inline su2double *CVertex::GetCoord(void) { return CartCoord; }
+inline su2double *CVertex::GetCoord(void) { return (CartCoord != NULL)? CartCoord : Zero_Coord; }
 
-inline su2double CVertex::GetCoord(unsigned short val_dim) { return CartCoord[val_dim]; }
+inline su2double CVertex::GetCoord(unsigned short val_dim) { return (CartCoord != NULL)? CartCoord[val_dim] : 0.0; }
 
 inline void CVertex::SetAuxVar(su2double val_auxvar) { Aux_Var = val_auxvar; }
 
@@ -302,16 +302,19 @@ inline void CVertex::SetNormal(su2double *val_face_normal) {
 }
 
 inline void CVertex::SetVarCoord(su2double *val_varcoord) { 
+	if (VarCoord == NULL) { VarCoord = new su2double[3]; VarCoord[0] = 0.0; VarCoord[1] = 0.0; VarCoord[2] = 0.0; }
 	for (unsigned short iDim = 0; iDim < nDim; iDim++) 
 		VarCoord[iDim] = val_varcoord[iDim];
 }
 
 inline void CVertex::AddVarCoord(su2double *val_varcoord) { 
+	if (VarCoord == NULL) { VarCoord = new su2double[3]; VarCoord[0] = 0.0; VarCoord[1] = 0.0; VarCoord[2] = 0.0; }
 	for (unsigned short iDim = 0; iDim < nDim; iDim++) 
 		VarCoord[iDim] += val_varcoord[iDim];
 }
 
 inline void CVertex::SetCoord(su2double *val_coord) { 
+	if (CartCoord == NULL) { CartCoord = new su2double[3]; CartCoord[0] = 0.0; CartCoord[1] = 0.0; CartCoord[2] = 0.0; }
 	for (unsigned short iDim = 0; iDim < nDim; iDim++) 
 		CartCoord[iDim] = val_coord[iDim];
 }
@@ -321,18 +324,21 @@ inline void CVertex::SetRotation_Type(short val_rotation_type) { Rotation_Type =
 inline short CVertex::GetRotation_Type(void) { return Rotation_Type; }
 
 inline void CVertex::SetDonorPoint(long val_periodicpoint, long val_processor) { 
+	AllocatePeriodicPoint();
 	PeriodicPoint[0] = val_periodicpoint; 
 	PeriodicPoint[1] = val_processor; 
 	PeriodicPoint[2] = 0;
 }
 
 inline void CVertex::SetDonorPoint(long val_periodicpoint, long val_processor, long val_globalindex) { 
+	AllocatePeriodicPoint();
 	PeriodicPoint[0] = val_periodicpoint; 
 	PeriodicPoint[1] = val_processor; 
 	PeriodicPoint[2] = val_globalindex;
 }
 
 inline void CVertex::SetDonorPoint(long val_periodicpoint, long val_periodicglobalindex, long val_periodicvertex, long val_periodicmarker, long val_processor) {
+  AllocatePeriodicPoint();
   PeriodicPoint[0] = val_periodicpoint;
   PeriodicPoint[1] = val_processor;
   PeriodicPoint[2] = val_periodicglobalindex;
@@ -350,23 +356,33 @@ inline void CVertex::SetDonorFace(unsigned short val_donorface) { Donor_Face = v
 
 inline unsigned short CVertex::GetDonorFace(void) { return Donor_Face; }
 
-inline long CVertex::GetDonorPoint(void) { return PeriodicPoint[0]; }
+inline long CVertex::GetDonorPoint(void) { return GetPeriodicPointDomain()[0]; }
 
-inline long CVertex::GetDonorProcessor(void) { return PeriodicPoint[1]; }
+inline long CVertex::GetDonorProcessor(void) { return GetPeriodicPointDomain()[1]; }
 
-inline long CVertex::GetDonorVertex(void) { return PeriodicPoint[3]; }
+inline long CVertex::GetDonorVertex(void) { return GetPeriodicPointDomain()[3]; }
 
-inline long CVertex::GetDonorGlobalIndex(void) { return PeriodicPoint[2]; }
+inline long CVertex::GetDonorGlobalIndex(void) { return GetPeriodicPointDomain()[2]; }
 
-inline long CVertex::GetGlobalDonorPoint(void) { return PeriodicPoint[2]; }
+inline long CVertex::GetGlobalDonorPoint(void) { return GetPeriodicPointDomain()[2]; }
 
-inline long CVertex::GetDonorMarker(void) { return PeriodicPoint[4]; }
+inline long CVertex::GetDonorMarker(void) { return GetPeriodicPointDomain()[4]; }
 
-inline void CVertex::SetBasisFunction(unsigned short val_node, su2double val_basis) { Basis_Function[val_node] = val_basis; }
+inline void CVertex::SetBasisFunction(unsigned short val_node, su2double val_basis) {
+  if (Basis_Function == NULL) { Basis_Function = new su2double[3]; Basis_Function[0] = 0.0; Basis_Function[1] = 0.0; Basis_Function[2] = 0.0; }
+  Basis_Function[val_node] = val_basis;
+}
+
+inline su2double CVertex::GetBasisFunction(unsigned short val_node) { return (Basis_Function != NULL)? Basis_Function[val_node] : 0.0; }
 
-inline su2double CVertex::GetBasisFunction(unsigned short val_node) { return Basis_Function[val_node]; }
+inline long *CVertex::GetPeriodicPointDomain(void) { return (PeriodicPoint != NULL)? PeriodicPoint : No_PeriodicPoint; }
 
-inline long *CVertex::GetPeriodicPointDomain(void) { return PeriodicPoint; }
+inline void CVertex::AllocatePeriodicPoint(void) {
+  if (PeriodicPoint == NULL) {
+    PeriodicPoint = new long[5];
+    for (unsigned short iVar = 0; iVar < 5; iVar++) PeriodicPoint[iVar] = -1;
+  }
+}
 
 inline bool CVertex::GetActDisk_Perimeter(void) { return ActDisk_Perimeter; }
 
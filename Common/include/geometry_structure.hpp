@@ -106,6 +106,8 @@ protected:
 	nZone,								/*!< \brief Number of zones in the problem. */
 	nMarker;				/*!< \brief Number of different markers of the mesh. */
   unsigned long Max_GlobalPoint;  /*!< \brief Greater global point in the domain local structure. */
+  vector<unsigned long> EdgeColorPtr;  /*!< \brief Start of each edge color in EdgeColorList (empty if there is no coloring). */
+  vector<unsigned long> EdgeColorList; /*!< \brief Edges grouped by color. */
 
 public:
 	unsigned long *nElem_Bound;			/*!< \brief Number of elements of the boundary. */
@@ -204,6 +206,27 @@ public:
 	 * \return Number of edges.
 	 */
 	unsigned long GetnEdge(void);
+  
+  /*!
+	 * \brief Get the number of edge colors (one color with all the edges if there is no coloring).
+	 * \return Number of edge colors.
+	 */
+	unsigned short GetnEdgeColor(void);
+  
+  /*!
+	 * \brief Get the number of edges of a color.
+	 * \param[in] val_color - Edge color.
+	 * \return Number of edges of the color.
+	 */
+	unsigned long GetnEdge_Color(unsigned short val_color);
+  
+  /*!
+	 * \brief Get an edge of a color, no two edges of the same color share a point.
+	 * \param[in] val_color - Edge color.
+	 * \param[in] val_edge - Position of the edge in the color.
+	 * \return Index of the edge.
+	 */
+	unsigned long GetEdge_Color(unsigned short val_color, unsigned long val_edge);
 
 	/*! 
 	 * \brief Get number of markers.
@@ -344,6 +367,12 @@ public:
 	 */
 	virtual void SetRCM_Ordering(CConfig *config);
   
+  /*!
+	 * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+	 */
+	virtual void SetSFC_Ordering(CConfig *config);
+  
 	/*!
 	 * \brief A virtual member.
 	 */		
@@ -354,6 +383,25 @@ public:
 	 */
 	void SetEdges(void);
 
+  /*!
+   * \brief Renumber the edges for cache locality, either sorted by (iPoint, jPoint) or grouped by color.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetEdge_Ordering(CConfig *config);
+
+  /*!
+   * \brief Greedy coloring of the edges, such that no two edges of the same color share a point.
+   * \param[out] EdgeColor - Color of each edge.
+   * \return Number of colors used.
+   */
+  unsigned short ComputeEdge_Colors(vector<unsigned short> &EdgeColor);
+
+  /*!
+   * \brief Group the edges in conflict-free colors, for race-free shared-memory edge loops.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetEdge_Coloring(CConfig *config);
+
 	/*! 
 	 * \brief A virtual member.
 	 */
@@ -475,6 +523,13 @@ public:
    */
   virtual void SetColorGrid_Parallel(CConfig *config);
   
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_cost - Measured work per domain point of this rank.
+   */
+  virtual void SetPartition_WeightsFile(CConfig *config, su2double val_cost);
+  
   /*!
 	 * \brief A virtual member.
 	 * \param[in] config - Definition of the particular problem.
@@ -1026,6 +1081,16 @@ public:
    * \param[in] val_nZone - Total number of domains in the grid file.
    */
   void Read_SU2_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
+  
+  /*!
+   * \brief Reads the geometry of the grid from a SU2 binary mesh file in parallel (for parmetis).
+   *        Each rank reads its slice of the points and elements directly from the file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_mesh_filename - Name of the file with the grid information.
+   * \param[in] val_iZone - Domain to be read from the grid file.
+   * \param[in] val_nZone - Total number of domains in the grid file.
+   */
+  void Read_SU2_Format_Binary_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
     
 
   /*!
@@ -1073,6 +1138,19 @@ public:
 	 */
 	void SetRCM_Ordering(CConfig *config);
   
+  /*!
+	 * \brief Set a renumbering of the domain points along a space-filling curve (Hilbert or Morton).
+   * \param[in] config - Definition of the particular problem.
+	 */
+	void SetSFC_Ordering(CConfig *config);
+  
+  /*!
+	 * \brief Apply a point renumbering to the coordinates, global indices and connectivities.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Result - Old local index of each new point (halo points must be kept at the end).
+	 */
+	void SetPoint_Renumbering(CConfig *config, vector<unsigned long> &Result);
+  
 	/*!
 	 * \brief Function declaration to avoid partially overridden classes.
 	 * \param[in] geometry - Geometrical definition of the problem.
@@ -1198,6 +1276,20 @@ public:
    */
   void SetColorGrid_Parallel(CConfig *config);
   
+  /*!
+   * \brief Compute the vertex weights (work of each local point) for the ParMETIS partitioning.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] val_weight - Work of each point of the initial linear partition.
+   */
+  void SetPartition_Weights(CConfig *config, vector<su2double> &val_weight);
+  
+  /*!
+   * \brief Write the measured work of each domain point, to be read back with PARTITION_WEIGHTS= MEASURED.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_cost - Measured work per domain point of this rank.
+   */
+  void SetPartition_WeightsFile(CConfig *config, su2double val_cost);
+  
 	/*!
 	 * \brief Set the rotational velocity at each node.
 	 * \param[in] config - Definition of the particular problem.
@@ -1529,6 +1621,46 @@ public:
 	 */
 	~CMultiGridGeometry(void);
 
+	/*! 
+	 * \brief Agglomerate the control volumes of this partition, the halo points are
+	 *        agglomerated as in the donor partitions.
+	 * \param[in] fine_grid - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 */	
+	void SetAgglomeration(CGeometry *fine_grid, CConfig *config);
+
+	/*! 
+	 * \brief Name of the agglomeration cache file of a multigrid level (one per partition).
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Level of the multigrid.
+	 * \return Name of the cache file.
+	 */	
+	string GetAgglomeration_CacheFile(CConfig *config, unsigned short iMesh);
+
+	/*! 
+	 * \brief Hash of the fine grid connectivity, used to validate the agglomeration cache.
+	 * \param[in] fine_grid - Geometrical definition of the problem.
+	 * \return Signature of the fine grid.
+	 */	
+	unsigned long GetAgglomeration_Signature(CGeometry *fine_grid);
+
+	/*! 
+	 * \brief Read the agglomeration (parent/children structure) stored by a previous run.
+	 * \param[in] fine_grid - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Level of the multigrid.
+	 * \return <code>TRUE</code> if the cache matches the fine grid on every rank and has been loaded; otherwise <code>FALSE</code>.
+	 */	
+	bool ReadAgglomeration_Cache(CGeometry *fine_grid, CConfig *config, unsigned short iMesh);
+
+	/*! 
+	 * \brief Write the agglomeration (parent/children structure) to be reused in later runs.
+	 * \param[in] fine_grid - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Level of the multigrid.
+	 */	
+	void WriteAgglomeration_Cache(CGeometry *fine_grid, CConfig *config, unsigned short iMesh);
+
 	/*! 
 	 * \brief Determine if a CVPoint van be agglomerated, if it have the same marker point as the seed.
 	 * \param[in] CVPoint - Control volume to be agglomerated.
@@ -1735,7 +1867,13 @@ public:
  * \date Aug 12, 2012
  */
 class CMultiGridQueue {
-	vector<vector<unsigned long> > QueueCV; /*!< \brief Queue structure to choose the next control volume in the agglomeration process. */
+	vector<long> QueueHead; /*!< \brief First control volume of each priority bucket (-1 if the bucket is empty). */
+	vector<long> QueueTail; /*!< \brief Last control volume of each priority bucket (-1 if the bucket is empty). */
+	long *NextQueueCV;	/*!< \brief Next control volume in the same priority bucket (flat linked list). */
+	long *PrevQueueCV;	/*!< \brief Previous control volume in the same priority bucket (flat linked list). */
+	short MaxPriority;	/*!< \brief Highest non-empty priority bucket. */
+	unsigned long nQueueCV;	/*!< \brief Number of control volumes in the queue. */
+	unsigned long nRightCV_Zero;	/*!< \brief Number of control volumes in the lowest priority that still can be agglomerated. */
 	short *Priority;	/*!< \brief The priority is based on the number of pre-agglomerated neighbors. */
 	bool *RightCV;	/*!< \brief In the lowest priority there are some CV that can not be agglomerated, this is the way to identify them */  
 	unsigned long nPoint; /*!< \brief Total number of points. */  
@@ -81,6 +81,8 @@ inline void CGeometry::SetColorGrid(CConfig *config) { }
 
 inline void CGeometry::SetColorGrid_Parallel(CConfig *config) { }
 
+inline void CGeometry::SetPartition_WeightsFile(CConfig *config, su2double val_cost) { }
+
 inline void CGeometry::DivideConnectivity(CConfig *config, unsigned short Elem_Type) { }
 
 inline void CGeometry::SetRotationalVelocity(CConfig *config, unsigned short val_iZone) { }
@@ -113,6 +115,8 @@ inline void CGeometry::SetPoint_Connectivity(void) { }
 
 inline void CGeometry::SetRCM_Ordering(CConfig *config) { }
 
+inline void CGeometry::SetSFC_Ordering(CConfig *config) { }
+
 inline void CGeometry::SetCoord_Smoothing (unsigned short val_nSmooth, su2double val_smooth_coeff, CConfig *config) { }
 
 inline void CGeometry::SetCoord(CGeometry *geometry) { }
@@ -157,6 +161,16 @@ inline unsigned long CGeometry::GetnVertex(unsigned short val_marker) { return n
 
 inline unsigned long CGeometry::GetnEdge(void) { return nEdge; }
 
+inline unsigned short CGeometry::GetnEdgeColor(void) { return (EdgeColorPtr.empty() ? 1 : EdgeColorPtr.size()-1); }
+
+inline unsigned long CGeometry::GetnEdge_Color(unsigned short val_color) {
+  return (EdgeColorPtr.empty() ? nEdge : EdgeColorPtr[val_color+1]-EdgeColorPtr[val_color]);
+}
+
+inline unsigned long CGeometry::GetEdge_Color(unsigned short val_color, unsigned long val_edge) {
+  return (EdgeColorPtr.empty() ? val_edge : EdgeColorList[EdgeColorPtr[val_color]+val_edge]);
+}
+
 inline bool CGeometry::FindFace(unsigned long first_elem, unsigned long second_elem, unsigned short &face_first_elem, unsigned short &face_second_elem) { return 0;}
 
 inline void CGeometry::SetBoundVolume(void) { }
@@ -118,8 +118,15 @@ public:
                        MPI_Datatype recvtype,int source, int recvtag,
                        MPI_Comm comm, MPI_Status *status);
 
+  /*!
+   * \brief Wall time spent in the blocking routines of the wrapper, used to
+   *        separate the work of a rank from the time it waits for the others.
+   */
+  static double GetCommTime(void);
+
 protected:
   static char* buff;
+  static double CommTime; /*!< \brief Accumulated wall time in blocking communications. */
 
 };
 /*!
@@ -50,11 +50,15 @@ inline void CMPIWrapper::Irecv(void *buf, int count, MPI_Datatype datatype,
 }
 
 inline void CMPIWrapper::Wait(MPI_Request *request, MPI_Status *status) {
+  double StartTime = MPI_Wtime();
   MPI_Wait(request,status);
+  CommTime += MPI_Wtime() - StartTime;
 }
 
 inline void CMPIWrapper::Waitall(int nrequests, MPI_Request *request, MPI_Status *status) {
+  double StartTime = MPI_Wtime();
   MPI_Waitall(nrequests,request,status);
+  CommTime += MPI_Wtime() - StartTime;
 }
 
 inline void CMPIWrapper::Send(void *buf, int count, MPI_Datatype datatype,
@@ -64,12 +68,16 @@ inline void CMPIWrapper::Send(void *buf, int count, MPI_Datatype datatype,
 
 inline void CMPIWrapper::Recv(void *buf, int count, MPI_Datatype datatype,
                               int dest,int tag, MPI_Comm comm, MPI_Status *status) {
+  double StartTime = MPI_Wtime();
   MPI_Recv(buf,count,datatype,dest,tag,comm,status);
+  CommTime += MPI_Wtime() - StartTime;
 }
 
 inline void CMPIWrapper::Bcast(void *buf, int count, MPI_Datatype datatype,
                                int root, MPI_Comm comm) {
+  double StartTime = MPI_Wtime();
   MPI_Bcast(buf,count,datatype,root,comm);
+  CommTime += MPI_Wtime() - StartTime;
 }
 
 inline void CMPIWrapper::Bsend(void *buf, int count, MPI_Datatype datatype,
@@ -79,27 +87,37 @@ inline void CMPIWrapper::Bsend(void *buf, int count, MPI_Datatype datatype,
 
 inline void CMPIWrapper::Reduce(void *sendbuf, void *recvbuf, int count,
                                 MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm) {
+  double StartTime = MPI_Wtime();
   MPI_Reduce(sendbuf, recvbuf,count,datatype,op,root,comm);
+  CommTime += MPI_Wtime() - StartTime;
 }
 
 inline void CMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
                                    MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) {
+  double StartTime = MPI_Wtime();
   MPI_Allreduce(sendbuf,recvbuf,count,datatype,op,comm);
+  CommTime += MPI_Wtime() - StartTime;
 }
 
 inline void CMPIWrapper::Gather(void *sendbuf, int sendcnt,MPI_Datatype sendtype,
                                 void *recvbuf, int recvcnt, MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  double StartTime = MPI_Wtime();
   MPI_Gather(sendbuf,sendcnt,sendtype,recvbuf,recvcnt,recvtype,root,comm);
+  CommTime += MPI_Wtime() - StartTime;
 }
 
 inline void CMPIWrapper::Scatter(void *sendbuf, int sendcnt,MPI_Datatype sendtype,
                                  void *recvbuf, int recvcnt, MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  double StartTime = MPI_Wtime();
   MPI_Scatter(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, root, comm);
+  CommTime += MPI_Wtime() - StartTime;
 }
 
 inline void CMPIWrapper::Allgather(void *sendbuf, int sendcnt, MPI_Datatype sendtype,
                                    void *recvbuf, int recvcnt, MPI_Datatype recvtype, MPI_Comm comm) {
+  double StartTime = MPI_Wtime();
   MPI_Allgather(sendbuf,sendcnt,sendtype, recvbuf, recvcnt, recvtype, comm);
+  CommTime += MPI_Wtime() - StartTime;
 }
 
 
@@ -107,13 +125,19 @@ inline void CMPIWrapper::Sendrecv(void *sendbuf, int sendcnt, MPI_Datatype sendt
                                   int dest, int sendtag, void *recvbuf, int recvcnt,
                                   MPI_Datatype recvtype,int source, int recvtag,
                                   MPI_Comm comm, MPI_Status *status) {
+  double StartTime = MPI_Wtime();
   MPI_Sendrecv(sendbuf,sendcnt,sendtype,dest,sendtag,recvbuf,recvcnt,recvtype,source,recvtag,comm,status);
+  CommTime += MPI_Wtime() - StartTime;
 }
 
 inline void CMPIWrapper::Waitany(int nrequests, MPI_Request *request,
                                  int *index, MPI_Status *status) {
+  double StartTime = MPI_Wtime();
   MPI_Waitany(nrequests, request, index, status);
+  CommTime += MPI_Wtime() - StartTime;
 }
+
+inline double CMPIWrapper::GetCommTime(void) { return CommTime; }
   
 #if defined COMPLEX_TYPE || defined ADOLC_FORWARD_TYPE || defined CODI_FORWARD_TYPE
 inline void CAuxMPIWrapper::Allgather(void *sendbuf, int sendcnt, MPI_Datatype sendtype, void *recvbuf, int recvcnt, MPI_Datatype recvtype, MPI_Comm comm) {
@@ -618,6 +618,47 @@ static const map<string, ENUM_LIMITER> Limiter_Map = CCreateMap<string, ENUM_LIM
 ("SHARP_EDGES", SHARP_EDGES)
 ("WALL_DISTANCE", SOLID_WALL_DISTANCE);
 
+/*!
+ * \brief types of point renumbering for cache locality
+ */
+enum ENUM_POINT_ORDERING {
+  NATURAL_POINT_ORDERING = 0,	/*!< \brief Keep the ordering produced by the partitioning. */
+  RCM_POINT_ORDERING = 1,	/*!< \brief Reverse Cuthill-McKee ordering. */
+  HILBERT_POINT_ORDERING = 2,	/*!< \brief Hilbert space-filling curve ordering. */
+  MORTON_POINT_ORDERING = 3	/*!< \brief Morton (Z-order) space-filling curve ordering. */
+};
+static const map<string, ENUM_POINT_ORDERING> Point_Ordering_Map = CCreateMap<string, ENUM_POINT_ORDERING>
+("NONE", NATURAL_POINT_ORDERING)
+("RCM", RCM_POINT_ORDERING)
+("HILBERT", HILBERT_POINT_ORDERING)
+("MORTON", MORTON_POINT_ORDERING);
+
+/*!
+ * \brief types of vertex weights for the graph partitioning
+ */
+enum ENUM_PARTITION_WEIGHTS {
+  UNIFORM_PARTITION_WEIGHTS = 0,	/*!< \brief All the points have the same weight. */
+  ESTIMATED_PARTITION_WEIGHTS = 1,	/*!< \brief Work estimated from the number of neighbors and the boundary points. */
+  MEASURED_PARTITION_WEIGHTS = 2	/*!< \brief Work measured in a previous run (PARTITION_WEIGHT_FILENAME). */
+};
+static const map<string, ENUM_PARTITION_WEIGHTS> Partition_Weights_Map = CCreateMap<string, ENUM_PARTITION_WEIGHTS>
+("NONE", UNIFORM_PARTITION_WEIGHTS)
+("ESTIMATED", ESTIMATED_PARTITION_WEIGHTS)
+("MEASURED", MEASURED_PARTITION_WEIGHTS);
+
+/*!
+ * \brief types of edge renumbering for cache locality
+ */
+enum ENUM_EDGE_ORDERING {
+  NATURAL_EDGE_ORDERING = 0,	/*!< \brief Keep the edges in creation order. */
+  SORTED_EDGE_ORDERING = 1,	/*!< \brief Sort the edges by (iPoint, jPoint). */
+  COLORED_EDGE_ORDERING = 2	/*!< \brief Group the edges by color, sorted by (iPoint, jPoint) within a color. */
+};
+static const map<string, ENUM_EDGE_ORDERING> Edge_Ordering_Map = CCreateMap<string, ENUM_EDGE_ORDERING>
+("NONE", NATURAL_EDGE_ORDERING)
+("SORTED", SORTED_EDGE_ORDERING)
+("COLORED", COLORED_EDGE_ORDERING);
+
 /*!
  * \brief types of turbulent models
  */
@@ -1116,13 +1157,17 @@ static const map<string, ENUM_ADAPT> Adapt_Map = CCreateMap<string, ENUM_ADAPT>
  */
 enum ENUM_INPUT {
   SU2 = 1,                       /*!< \brief SU2 input format. */
-  CGNS = 2                     /*!< \brief CGNS input format for the computational grid. */
+  CGNS = 2,                    /*!< \brief CGNS input format for the computational grid. */
+  SU2_BINARY = 3               /*!< \brief SU2 binary format for the computational grid. */
 };
 static const map<string, ENUM_INPUT> Input_Map = CCreateMap<string, ENUM_INPUT>
 ("SU2", SU2)
-("CGNS", CGNS);
+("CGNS", CGNS)
+("SU2_BINARY", SU2_BINARY);
 
 const int CGNS_STRING_SIZE = 33;/*!< \brief Length of strings used in the CGNS format. */
+const int SU2_BINARY_RESTART = 535532; /*!< \brief Identifier at the start of the SU2 binary restart files. */
+const int SU2_BINARY_MESH = 535533;    /*!< \brief Identifier at the start of the SU2 binary mesh files. */
 
 /*!
  * \brief type of solution output file formats
@@ -1134,7 +1179,9 @@ enum ENUM_OUTPUT {
   FIELDVIEW_BINARY = 4,  /*!< \brief FieldView binary format for the solution output. */
   CSV = 5,			         /*!< \brief Comma-separated values format for the solution output. */
   CGNS_SOL = 6,  	     	 /*!< \brief CGNS format for the solution output. */
-  PARAVIEW = 7  		     /*!< \brief Paraview format for the solution output. */
+  PARAVIEW = 7,  		     /*!< \brief Paraview format for the solution output. */
+  PARAVIEW_BINARY = 8,   /*!< \brief Paraview parallel binary (XML) format for the solution output. */
+  XDMF = 9               /*!< \brief XDMF format (XML description of raw binary data) for the solution output. */
 };
 static const map<string, ENUM_OUTPUT> Output_Map = CCreateMap<string, ENUM_OUTPUT>
 ("TECPLOT", TECPLOT)
@@ -1143,7 +1190,22 @@ static const map<string, ENUM_OUTPUT> Output_Map = CCreateMap<string, ENUM_OUTPU
 ("FIELDVIEW_BINARY", FIELDVIEW_BINARY)
 ("CSV", CSV)
 ("CGNS", CGNS_SOL)
-("PARAVIEW", PARAVIEW);
+("PARAVIEW", PARAVIEW)
+("PARAVIEW_BINARY", PARAVIEW_BINARY)
+("XDMF", XDMF);
+
+/*!
+ * \brief types of history stream files
+ */
+enum ENUM_HISTORY_STREAM {
+  NO_STREAM = 0,         /*!< \brief No history stream. */
+  STREAM_BINARY = 1,     /*!< \brief Schema line followed by raw double precision records. */
+  STREAM_JSON = 2        /*!< \brief Schema line followed by one JSON array per record. */
+};
+static const map<string, ENUM_HISTORY_STREAM> History_Stream_Map = CCreateMap<string, ENUM_HISTORY_STREAM>
+("NONE", NO_STREAM)
+("BINARY", STREAM_BINARY)
+("JSON", STREAM_JSON);
 
 /*!
  * \brief type of jump definition
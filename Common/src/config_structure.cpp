@@ -222,6 +222,21 @@ void CConfig::SetMPICommunicator(SU2_Comm Communicator) {
         }
 
         break;
+      case SU2_BINARY: {
+
+        /*--- The counts are stored in the fixed size header of the binary mesh. ---*/
+
+        int header_int[4]; unsigned long header_long[4];
+        mesh_file.open(val_mesh_filename.c_str(), ios::in | ios::binary);
+        if (mesh_file.fail()) {
+          cout << "There is no geometry file (GetnElem))!" << endl;
+          break;
+        }
+        mesh_file.read((char *)header_int, 4*sizeof(int));
+        mesh_file.read((char *)header_long, 4*sizeof(unsigned long));
+        if (mesh_file.good() && header_int[0] == SU2_BINARY_MESH) nElem = header_long[0];
+        break;
+      }
       case CGNS:
     	  cout << "ERROR - JRH - CGNS Lookup of NELEM= not implemented yet in Configuration yet!!" << endl;
     	  break;
@@ -268,6 +283,21 @@ unsigned long CConfig::GetnPoin(string val_mesh_filename, unsigned short val_for
         }
 
         break;
+      case SU2_BINARY: {
+
+        /*--- The counts are stored in the fixed size header of the binary mesh. ---*/
+
+        int header_int[4]; unsigned long header_long[4];
+        mesh_file.open(val_mesh_filename.c_str(), ios::in | ios::binary);
+        if (mesh_file.fail()) {
+          cout << "There is no geometry file (GetnPoin))!" << endl;
+          break;
+        }
+        mesh_file.read((char *)header_int, 4*sizeof(int));
+        mesh_file.read((char *)header_long, 4*sizeof(unsigned long));
+        if (mesh_file.good() && header_int[0] == SU2_BINARY_MESH) nPoin = header_long[2];
+        break;
+      }
       case CGNS:
     	  cout << "ERROR - JRH - CGNS Lookup of NPOIN= not implemented yet in Configuration yet!!" << endl;
     	  break;
@@ -307,6 +337,17 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
     }
     break;
 
+  case SU2_BINARY:
+
+    /*--- Read the dimension from the header of the binary mesh file ---*/
+
+    int header_int[4];
+    mesh_file.close();
+    mesh_file.open(cstr, ios::in | ios::binary);
+    mesh_file.read((char *)header_int, 4*sizeof(int));
+    if (mesh_file.good() && header_int[0] == SU2_BINARY_MESH) nDim = header_int[1];
+    break;
+
   case CGNS:
 
 #ifdef HAVE_CGNS
@@ -390,7 +431,7 @@ void CConfig::SetPointersNull(void) {
   
   Marker_DV                   = NULL;   Marker_Moving            = NULL;    Marker_Monitoring = NULL;
   Marker_Designing            = NULL;   Marker_GeoEval           = NULL;    Marker_Plotting   = NULL;
-  Marker_Analyze              = NULL;
+  Marker_Analyze              = NULL;   Marker_Output_Filter     = NULL;
   Marker_CfgFile_KindBC       = NULL;   Marker_All_KindBC        = NULL;
   
   /*--- Marker Pointers ---*/
@@ -542,6 +583,8 @@ void CConfig::SetPointersNull(void) {
   default_distortion    = NULL;
   default_ea_lim        = NULL;
   default_grid_fix      = NULL;
+  default_output_box    = NULL;
+  default_output_walldist = NULL;
   default_inc_crit      = NULL;
   default_htp_axis      = NULL;
 
@@ -610,6 +653,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   default_distortion    = new su2double[2];
   default_ea_lim        = new su2double[3];
   default_grid_fix      = new su2double[6];
+  default_output_box    = new su2double[6];
+  default_output_walldist = new su2double[2];
   default_inc_crit      = new su2double[3];
   default_htp_axis      = new su2double[2];
 
@@ -1007,6 +1052,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addLongOption("UNST_RESTART_ITER", Unst_RestartIter, 0);
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
+  /* DESCRIPTION: Number of direct time levels kept in memory by the unsteady discrete adjoint (0 reads every restart file from disk) */
+  addUnsignedShortOption("UNST_ADJOINT_CHECKPOINTS", Unst_Adjoint_Checkpoints, 4);
+  /* DESCRIPTION: Compress the direct time levels kept in memory by the unsteady discrete adjoint (lossless, requires ZLIB) */
+  addBoolOption("UNST_ADJOINT_CHECKPOINT_COMPRESS", Unst_Adjoint_Checkpoint_Compress, false);
   /* DESCRIPTION: Number of iterations to average the objective */
   addLongOption("ITER_AVERAGE_OBJ", Iter_Avg_Objective , 0);
   /* DESCRIPTION: Iteration number to begin unsteady restarts (structural analysis) */
@@ -1127,6 +1176,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_AGGLOMERATION_CACHE\n DESCRIPTION: Store the agglomeration of the coarse levels on disk and reuse it when the mesh and partition match. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_AGGLOMERATION_CACHE", MG_Agglomeration_Cache, false);
+  /*!\brief MG_CACHE_FILENAME\n DESCRIPTION: Root name of the agglomeration cache files. DEFAULT: mg_cache \ingroup Config*/
+  addStringOption("MG_CACHE_FILENAME", MG_Cache_FileName, string("mg_cache"));
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -1134,6 +1187,15 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /*!\brief NUM_METHOD_GRAD
    *  \n DESCRIPTION: Numerical method for spatial gradients \n OPTIONS: See \link Gradient_Map \endlink. \n DEFAULT: WEIGHTED_LEAST_SQUARES. \ingroup Config*/
   addEnumOption("NUM_METHOD_GRAD", Kind_Gradient_Method, Gradient_Map, WEIGHTED_LEAST_SQUARES);
+  /*!\brief POINT_ORDERING
+   *  \n DESCRIPTION: Renumbering of the points for cache locality (halo points are always kept at the end) \n OPTIONS: See \link Point_Ordering_Map \endlink. \n DEFAULT: RCM. \ingroup Config*/
+  addEnumOption("POINT_ORDERING", Kind_Point_Ordering, Point_Ordering_Map, RCM_POINT_ORDERING);
+  /*!\brief EDGE_ORDERING
+   *  \n DESCRIPTION: Renumbering of the edges for cache locality \n OPTIONS: See \link Edge_Ordering_Map \endlink. \n DEFAULT: NONE. \ingroup Config*/
+  addEnumOption("EDGE_ORDERING", Kind_Edge_Ordering, Edge_Ordering_Map, NATURAL_EDGE_ORDERING);
+  /*!\brief EDGE_COLORING
+   *  \n DESCRIPTION: Group the edges in colors such that no two edges of a color share a point, for race-free threaded edge loops (always on with HAVE_OMP). \n DEFAULT: NO. \ingroup Config*/
+  addBoolOption("EDGE_COLORING", Edge_Coloring, false);
   /*!\brief LIMITER_COEFF
    *  \n DESCRIPTION: Coefficient for the limiter. DEFAULT value 0.5. Larger values decrease the extent of limiting, values approaching zero cause lower-order approximation to the solution. \ingroup Config */
   addDoubleOption("LIMITER_COEFF", LimiterCoeff, 0.5);
@@ -1263,9 +1325,25 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /*!\brief MESH_OUT_FORMAT \n DESCRIPTION: Mesh output file format (SU2 or SU2_BINARY). Used when converting, scaling, or deforming a mesh. \n OPTIONS: see \link Input_Map \endlink \n DEFAULT: SU2 \ingroup Config*/
+  addEnumOption("MESH_OUT_FORMAT", Mesh_Out_FileFormat, Input_Map, SU2);
+  /*!\brief PARTITION_WEIGHTS \n DESCRIPTION: Vertex weights for the ParMETIS partitioning, balanced together with the point count \n OPTIONS: see \link Partition_Weights_Map \endlink \n DEFAULT: NONE \ingroup Config*/
+  addEnumOption("PARTITION_WEIGHTS", Kind_Partition_Weights, Partition_Weights_Map, UNIFORM_PARTITION_WEIGHTS);
+  /*!\brief PARTITION_WEIGHT_EDGE \n DESCRIPTION: Estimated work of each edge of a point, relative to the point itself (PARTITION_WEIGHTS= ESTIMATED) \n DEFAULT: 0.1 \ingroup Config*/
+  addDoubleOption("PARTITION_WEIGHT_EDGE", Partition_Weight_Edge, 0.1);
+  /*!\brief PARTITION_WEIGHT_BOUNDARY \n DESCRIPTION: Estimated extra work of a boundary point (PARTITION_WEIGHTS= ESTIMATED) \n DEFAULT: 1.0 \ingroup Config*/
+  addDoubleOption("PARTITION_WEIGHT_BOUNDARY", Partition_Weight_Boundary, 1.0);
+  /*!\brief PARTITION_WEIGHT_FILENAME \n DESCRIPTION: Measured work of each point, read with PARTITION_WEIGHTS= MEASURED and written with WRT_PARTITION_WEIGHTS= YES \n DEFAULT: partition_weights.dat \ingroup Config*/
+  addStringOption("PARTITION_WEIGHT_FILENAME", Partition_Weight_FileName, string("partition_weights.dat"));
+  /*!\brief WRT_PARTITION_WEIGHTS \n DESCRIPTION: Write the measured work of each point at the end of the run \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("WRT_PARTITION_WEIGHTS", Wrt_Partition_Weights, false);
 
   /*!\brief CONV_FILENAME \n DESCRIPTION: Output file convergence history (w/o extension) \n DEFAULT: history \ingroup Config*/
   addStringOption("CONV_FILENAME", Conv_FileName, string("history"));
+  /*!\brief HISTORY_STREAM \n DESCRIPTION: Also write the convergence history as a stream with a schema header (CONV_FILENAME with extension .hist for BINARY, .jsonl for JSON) \n OPTIONS: see \link History_Stream_Map \endlink \n DEFAULT: NONE \ingroup Config*/
+  addEnumOption("HISTORY_STREAM", Kind_History_Stream, History_Stream_Map, NO_STREAM);
+  /*!\brief HISTORY_STREAM_BATCH \n DESCRIPTION: Number of iterations buffered before the history stream is written to disk \n DEFAULT: 100 \ingroup Config*/
+  addUnsignedLongOption("HISTORY_STREAM_BATCH", History_Stream_Batch, 100);
   /*!\brief BREAKDOWN_FILENAME \n DESCRIPTION: Output file forces breakdown \ingroup Config*/
   addStringOption("BREAKDOWN_FILENAME", Breakdown_FileName, string("forces_breakdown.dat"));
   /*!\brief CONV_FILENAME \n DESCRIPTION: Output file convergence history (w/o extension) \n DEFAULT: history \ingroup Config*/
@@ -1354,6 +1432,15 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /*!\brief WRT_CSV_SOL
    *  \n DESCRIPTION: Write a surface CSV solution file  \ingroup Config*/
   addBoolOption("WRT_CSV_SOL", Wrt_Csv_Sol, true);
+  /*!\brief WRT_BINARY_RESTART
+   *  \n DESCRIPTION: Write the restart file in the SU2 binary format (header with the variable names, then fixed-width records sorted by global index)  \ingroup Config*/
+  addBoolOption("WRT_BINARY_RESTART", Wrt_Binary_Restart, false);
+  /*!\brief READ_BINARY_RESTART
+   *  \n DESCRIPTION: Read the restart file in the SU2 binary format  \ingroup Config*/
+  addBoolOption("READ_BINARY_RESTART", Read_Binary_Restart, false);
+  /*!\brief ASYNC_OUTPUT
+   *  \n DESCRIPTION: Write the restart and the Tecplot/Paraview ASCII solution files from a background thread, while the solver keeps iterating  \ingroup Config*/
+  addBoolOption("ASYNC_OUTPUT", Async_Output, false);
   /*!\brief WRT_RESIDUALS
    *  \n DESCRIPTION: Output residual info to solution/restart file  \ingroup Config*/
   addBoolOption("WRT_RESIDUALS", Wrt_Residuals, false);
@@ -1365,6 +1452,21 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addBoolOption("WRT_SHARPEDGES", Wrt_SharpEdges, false);
   /* DESCRIPTION: Output the rind layers in the solution files  \ingroup Config*/
   addBoolOption("WRT_HALO", Wrt_Halo, false);
+  /*!\brief OUTPUT_FILTER_BOX
+   *  \n DESCRIPTION: Write only the points inside this box (Xmin, Ymin, Zmin, Xmax, Ymax, Zmax) to the parallel volume solution files  \ingroup Config*/
+  default_output_box[0] = -1E15; default_output_box[1] = -1E15; default_output_box[2] = -1E15;
+  default_output_box[3] =  1E15; default_output_box[4] =  1E15; default_output_box[5] =  1E15;
+  addDoubleArrayOption("OUTPUT_FILTER_BOX", 6, Output_Filter_Box, default_output_box);
+  /*!\brief OUTPUT_FILTER_WALLDIST
+   *  \n DESCRIPTION: Write only the points whose wall distance is inside this band (min, max) to the parallel volume solution files  \ingroup Config*/
+  default_output_walldist[0] = 0.0; default_output_walldist[1] = 1E15;
+  addDoubleArrayOption("OUTPUT_FILTER_WALLDIST", 2, Output_Filter_WallDist, default_output_walldist);
+  /*!\brief OUTPUT_FILTER_MARKER
+   *  \n DESCRIPTION: Write only the points of these markers to the parallel volume solution files  \ingroup Config*/
+  addStringListOption("OUTPUT_FILTER_MARKER", nMarker_Output_Filter, Marker_Output_Filter);
+  /*!\brief OUTPUT_FILTER_STRIDE
+   *  \n DESCRIPTION: Write only every Nth point (by global index) to the parallel volume solution files  \ingroup Config*/
+  addUnsignedLongOption("OUTPUT_FILTER_STRIDE", Output_Filter_Stride, 1);
   /*!\brief ONE_D_OUTPUT
    *  \n DESCRIPTION: Output averaged outlet flow values on specified exit marker. \n Use with MARKER_OUT_1D. \ingroup Config*/
   addBoolOption("ONE_D_OUTPUT", Wrt_1D_Output, false);
@@ -2103,6 +2205,15 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   }
 #endif
   
+  /*--- The output filters are active as soon as one of them differs from its default ---*/
+  
+  if (Output_Filter_Stride == 0) Output_Filter_Stride = 1;
+  Output_Filter = ((nMarker_Output_Filter != 0) || (Output_Filter_Stride > 1) ||
+                   (Output_Filter_WallDist[0] > 0.0) || (Output_Filter_WallDist[1] < 1E15));
+  for (iMarker = 0; iMarker < 3; iMarker++) {
+    if ((Output_Filter_Box[iMarker] > -1E15) || (Output_Filter_Box[iMarker+3] < 1E15)) Output_Filter = true;
+  }
+  
   /*--- Fixed CM mode requires a static movement of the grid ---*/
   
   if (Fixed_CM_Mode) {
@@ -2200,7 +2311,17 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   if ((rank==MASTER_NODE) && ContinuousAdjoint && (Ref_NonDim == DIMENSIONAL) && (Kind_SU2 == SU2_CFD)) {
     cout << "WARNING: The adjoint solver should use a non-dimensional flow solution." << endl;
   }
-  
+
+  /*--- The compression of the unsteady adjoint checkpoints relies on ZLIB ---*/
+
+#ifndef HAVE_ZLIB
+  if (Unst_Adjoint_Checkpoint_Compress) {
+    if ((rank == MASTER_NODE) && DiscreteAdjoint && (Kind_SU2 == SU2_CFD))
+      cout << "WARNING: SU2 was built without ZLIB, the unsteady adjoint checkpoints are stored uncompressed." << endl;
+    Unst_Adjoint_Checkpoint_Compress = false;
+  }
+#endif
+
   /*--- Initialize non-physical points/reconstructions to zero ---*/
   
   Nonphys_Points   = 0;
@@ -4859,6 +4980,8 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
 
     switch (Output_FileFormat) {
       case PARAVIEW: cout << "The output file format is Paraview ASCII (.vtk)." << endl; break;
+      case PARAVIEW_BINARY: cout << "The output file format is Paraview binary (.pvtu)." << endl; break;
+      case XDMF: cout << "The output file format is XDMF (.xmf)." << endl; break;
       case TECPLOT: cout << "The output file format is Tecplot ASCII (.dat)." << endl; break;
       case TECPLOT_BINARY: cout << "The output file format is Tecplot binary (.plt)." << endl; break;
       case FIELDVIEW: cout << "The output file format is FieldView ASCII (.uns)." << endl; break;
@@ -4896,6 +5019,8 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
     if (Low_MemoryOutput) cout << "Writing output files with low memory RAM requirements."<< endl;
     switch (Output_FileFormat) {
       case PARAVIEW: cout << "The output file format is Paraview ASCII (.vtk)." << endl; break;
+      case PARAVIEW_BINARY: cout << "The output file format is Paraview binary (.pvtu)." << endl; break;
+      case XDMF: cout << "The output file format is XDMF (.xmf)." << endl; break;
       case TECPLOT: cout << "The output file format is Tecplot ASCII (.dat)." << endl; break;
       case TECPLOT_BINARY: cout << "The output file format is Tecplot binary (.plt)." << endl; break;
       case FIELDVIEW: cout << "The output file format is FieldView ASCII (.uns)." << endl; break;
@@ -5620,6 +5745,7 @@ CConfig::~CConfig(void) {
   if (Marker_Designing != NULL)       delete[] Marker_Designing;
   if (Marker_GeoEval != NULL)         delete[] Marker_GeoEval;
   if (Marker_Plotting != NULL)        delete[] Marker_Plotting;
+  if (Marker_Output_Filter != NULL)   delete[] Marker_Output_Filter;
   if (Marker_Analyze != NULL)        delete[] Marker_Analyze;
   if (Marker_FSIinterface != NULL)        delete[] Marker_FSIinterface;
   if (Marker_All_SendRecv != NULL)    delete[] Marker_All_SendRecv;
@@ -5848,6 +5974,8 @@ CConfig::~CConfig(void) {
   if (default_distortion    != NULL) delete [] default_distortion;
   if (default_ea_lim        != NULL) delete [] default_ea_lim;
   if (default_grid_fix      != NULL) delete [] default_grid_fix;
+  if (default_output_box    != NULL) delete [] default_output_box;
+  if (default_output_walldist != NULL) delete [] default_output_walldist;
   if (default_inc_crit      != NULL) delete [] default_inc_crit;
   if (default_htp_axis      != NULL) delete [] default_htp_axis;
 
@@ -524,41 +524,32 @@ void CEdge::SetNodes_Coord(su2double *val_coord_Edge_CG, su2double *val_coord_El
 
 }
 
+su2double CVertex::Zero_Coord[3] = {0.0, 0.0, 0.0};
+
+long CVertex::No_PeriodicPoint[5] = {-1, -1, -1, -1, -1};
+
 CVertex::CVertex(unsigned long val_point, unsigned short val_nDim) : CDualGrid(val_nDim) {
 
   unsigned short iDim;
 
-  /*--- Set periodic points to zero ---*/
+  /*--- The periodic points, coordinates, coordinate variation and
+   interpolation data are only allocated when a feature sets them ---*/
   
-  PeriodicPoint[0] = -1; PeriodicPoint[1] = -1; PeriodicPoint[2] = -1;
-  PeriodicPoint[3] = -1; PeriodicPoint[4] = -1;
+  PeriodicPoint  = NULL;
+  CartCoord      = NULL;
+  VarCoord       = NULL;
+  Basis_Function = NULL;
   
   /*--- Identify the points at the perimeter of the actuatrod disk ---*/
   
   ActDisk_Perimeter = false;
 
-  /*--- Pointers initialization ---*/
-  
-  Nodes  = NULL;
-  Normal = NULL;
-
-  /*--- Allocate node, and face normal ---*/
-  
-  Nodes  = new unsigned long[1]; 
-  Normal = new su2double [nDim];
-
-  /*--- Initializate the structure ---*/
+  /*--- Initializate the node, and face normal ---*/
   
   Nodes[0] = val_point;
-  for (iDim = 0; iDim < nDim; iDim ++) 
+  for (iDim = 0; iDim < 3; iDim ++) 
     Normal[iDim] = 0.0;
 
-  /*--- Set to zero the variation of the coordinates ---*/
-  
-  VarCoord[0] = 0.0; 
-  VarCoord[1] = 0.0; 
-  VarCoord[2] = 0.0;
-
   /*--- Set to NULL variation of the rotation  ---*/
   
   VarRot = NULL;
@@ -574,8 +565,10 @@ CVertex::CVertex(unsigned long val_point, unsigned short val_nDim) : CDualGrid(v
 
 CVertex::~CVertex() {
   
-  if (Normal != NULL) delete[] Normal;
-  if (Nodes  != NULL) delete[] Nodes;
+  if (PeriodicPoint  != NULL) delete[] PeriodicPoint;
+  if (CartCoord      != NULL) delete[] CartCoord;
+  if (VarCoord       != NULL) delete[] VarCoord;
+  if (Basis_Function != NULL) delete[] Basis_Function;
 
   /*---  donor arrays for interpolation ---*/
   
@@ -226,6 +226,11 @@ void CGeometry::SetEdges(void) {
   unsigned short jNode, iNode;
   long TestEdge = 0;
   
+  /*--- Any previous edge coloring is no longer valid ---*/
+  
+  EdgeColorPtr.clear();
+  EdgeColorList.clear();
+  
   nEdge = 0;
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
@@ -252,6 +257,107 @@ void CGeometry::SetEdges(void) {
     }
 }
 
+void CGeometry::SetEdge_Ordering(CConfig *config) {
+  unsigned long iEdge, iPoint, jPoint;
+  unsigned short iNode;
+  
+  unsigned short Kind_Ordering = config->GetKind_Edge_Ordering();
+  if ((Kind_Ordering == NATURAL_EDGE_ORDERING) || (nEdge == 0)) return;
+  
+  /*--- Sort key of each edge: (color, iPoint, jPoint), the color is
+   zero for all the edges when they are only sorted by points ---*/
+  
+  vector<unsigned short> EdgeColor(nEdge, 0);
+  if (Kind_Ordering == COLORED_EDGE_ORDERING) ComputeEdge_Colors(EdgeColor);
+  
+  vector<pair<pair<unsigned short, unsigned long>, pair<unsigned long, unsigned long> > > Key(nEdge);
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    iPoint = edge[iEdge]->GetNode(0);
+    jPoint = edge[iEdge]->GetNode(1);
+    Key[iEdge] = make_pair(make_pair(EdgeColor[iEdge], iPoint), make_pair(jPoint, iEdge));
+  }
+  sort(Key.begin(), Key.end());
+  
+  /*--- Permute the edges, the point-edge connectivity is updated through
+   the new index of each edge ---*/
+  
+  CEdge **AuxEdge = new CEdge* [nEdge];
+  vector<long> NewIndex(nEdge);
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    AuxEdge[iEdge] = edge[Key[iEdge].second.second];
+    NewIndex[Key[iEdge].second.second] = iEdge;
+  }
+  delete [] edge;
+  edge = AuxEdge;
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++)
+      node[iPoint]->SetEdge(NewIndex[node[iPoint]->GetEdge(iNode)], iNode);
+  
+}
+
+unsigned short CGeometry::ComputeEdge_Colors(vector<unsigned short> &EdgeColor) {
+  unsigned long iEdge, iPoint, jPoint;
+  unsigned short iColor, nColor = 0;
+  
+  /*--- For each point, the list of colors already used by its edges ---*/
+  
+  vector<vector<unsigned short> > PointColors(nPoint);
+  
+  EdgeColor.resize(nEdge);
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    iPoint = edge[iEdge]->GetNode(0);
+    jPoint = edge[iEdge]->GetNode(1);
+    
+    /*--- Lowest color that is free in both points ---*/
+    
+    for (iColor = 0; ; iColor++) {
+      if ((find(PointColors[iPoint].begin(), PointColors[iPoint].end(), iColor) == PointColors[iPoint].end()) &&
+          (find(PointColors[jPoint].begin(), PointColors[jPoint].end(), iColor) == PointColors[jPoint].end())) break;
+    }
+    
+    EdgeColor[iEdge] = iColor;
+    PointColors[iPoint].push_back(iColor);
+    PointColors[jPoint].push_back(iColor);
+    if (iColor+1 > nColor) nColor = iColor+1;
+  }
+  
+  return nColor;
+  
+}
+
+void CGeometry::SetEdge_Coloring(CConfig *config) {
+  unsigned long iEdge;
+  unsigned short iColor, nColor;
+  
+  bool coloring = config->GetEdge_Coloring();
+#ifdef HAVE_OMP
+  coloring = true;
+#endif
+  
+  EdgeColorPtr.clear();
+  EdgeColorList.clear();
+  if ((!coloring) || (nEdge == 0)) return;
+  
+  vector<unsigned short> EdgeColor;
+  nColor = ComputeEdge_Colors(EdgeColor);
+  
+  /*--- Compressed storage of the edges of each color, the edges keep
+   their relative order inside a color ---*/
+  
+  EdgeColorPtr.assign(nColor+1, 0);
+  for (iEdge = 0; iEdge < nEdge; iEdge++)
+    EdgeColorPtr[EdgeColor[iEdge]+1]++;
+  for (iColor = 0; iColor < nColor; iColor++)
+    EdgeColorPtr[iColor+1] += EdgeColorPtr[iColor];
+  
+  vector<unsigned long> Counter(EdgeColorPtr.begin(), EdgeColorPtr.end()-1);
+  EdgeColorList.resize(nEdge);
+  for (iEdge = 0; iEdge < nEdge; iEdge++)
+    EdgeColorList[Counter[EdgeColor[iEdge]]++] = iEdge;
+  
+}
+
 void CGeometry::SetFaces(void) {
   //	unsigned long iPoint, jPoint, iFace;
   //	unsigned short jNode, iNode;
@@ -1358,6 +1464,9 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
     case CGNS:
       Read_CGNS_Format_Parallel(config, val_mesh_filename, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      Read_SU2_Format_Binary_Parallel(config, val_mesh_filename, val_iZone, val_nZone);
+      break;
     default:
       if (rank == MASTER_NODE) cout << "Unrecognized mesh format specified!" << endl;
 #ifndef HAVE_MPI
@@ -6859,74 +6968,64 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
   
 }
 
-void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
+#ifdef HAVE_MPI
+static void Read_Binary_Mesh_Block(MPI_File &mesh_file, unsigned long offset, void *buf, unsigned long nBytes) {
   
-  /*--- Original CGNS reader implementation by Thomas D. Economon,
-   Francisco Palacios. Improvements for mixed-element meshes generated
-   by ICEM added by Martin Spel (3D) & Shlomy Shitrit (2D), April 2014.
-   Parallel version by Thomas D. Economon, February 2015. ---*/
+  /*--- Collective read, every rank must call this with its own (possibly empty) block. ---*/
   
-#ifdef HAVE_CGNS
-    
-  string text_line, Marker_Tag;
-  ifstream mesh_file;
-  unsigned short VTK_Type = 0, iMarker = 0;
-  unsigned short nMarker_Max = config->GetnMarker_Max();
-  unsigned long iPoint = 0, iProcessor = 0, ielem = 0, GlobalIndex = 0;
-  unsigned long globalOffset = 0;
-  nZone = val_nZone;
+  MPI_Status status;
+  MPI_File_read_at_all(mesh_file, (MPI_Offset)offset, buf, (int)nBytes, MPI_BYTE, &status);
   
-  /*--- Local variables needed when calling the CGNS mid-level API. ---*/
+}
+#else
+static void Read_Binary_Mesh_Block(ifstream &mesh_file, unsigned long offset, void *buf, unsigned long nBytes) {
   
-  unsigned long vnodes_cgns[8] = {0,0,0,0,0,0,0,0};
-  su2double Coord_cgns[3] = {0.0,0.0,0.0};
-  int fn, nbases = 0, nzones = 0, ngrids = 0, ncoords = 0, nsections = 0;
-  int *vertices = NULL, *cells = NULL, nMarkers = 0, *boundVerts = NULL, npe;
-  int interiorElems = 0, totalVerts = 0;
-  int cell_dim = 0, phys_dim = 0, nbndry, parent_flag, file_type;
-  char basename[CGNS_STRING_SIZE], zonename[CGNS_STRING_SIZE];
-  char coordname[CGNS_STRING_SIZE];
-  cgsize_t* cgsize; cgsize = new cgsize_t[3];
-  ZoneType_t zonetype;
-  DataType_t datatype;
-  passivedouble** coordArray = NULL;
-  passivedouble*** gridCoords = NULL;
-  ElementType_t elemType;
-  cgsize_t range_min, range_max, startE, endE;
-  range_min = 1;
-  string currentElem;
-  int** elemTypeVTK = NULL;
-  int** elemIndex = NULL;
-  int** elemBegin = NULL;
-  int** elemEnd = NULL;
-  int** nElems = NULL;
-  cgsize_t**** connElems = NULL;
-  cgsize_t* connElemCGNS = NULL;
-  cgsize_t* connElemTemp = NULL;
-  cgsize_t ElementDataSize = 0;
-  cgsize_t* parentData = NULL;
-  int** dataSize = NULL;
-  bool** isInternal = NULL;
-  char*** sectionNames = NULL;
+  mesh_file.seekg(offset);
+  mesh_file.read((char *)buf, nBytes);
   
-  /*--- Initialize counters for local/global points & elements ---*/
+}
+#endif
+
+void CPhysicalGeometry::Read_SU2_Format_Binary_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
+  
+  unsigned short nMarker_Max = config->GetnMarker_Max();
+  unsigned long iPoint, iElem, iNode, jNode, iElem_Bound, iMarker, offset, i;
+  unsigned long vnodes[N_POINTS_HEXAHEDRON];
+  unsigned short iDim, iPeriodic, nNodes;
+  long local_index;
+  su2double AoA_Offset, AoS_Offset, AoA_Current, AoS_Current;
+  int rank = MASTER_NODE, size = SINGLE_NODE, iProcessor;
+  bool harmonic_balance = config->GetUnsteady_Simulation() == HARMONIC_BALANCE;
+  bool actuator_disk  = (((config->GetnMarker_ActDiskInlet() != 0) ||
+                          (config->GetnMarker_ActDiskOutlet() != 0)) &&
+                         ((config->GetKind_SU2() == SU2_CFD) ||
+                          ((config->GetKind_SU2() == SU2_DEF) && (config->GetActDisk_SU2_DEF()))));
+  if (config->GetActDisk_DoubleSurface()) actuator_disk = false;
+  
+  nZone = val_nZone;
   
-  int rank = MASTER_NODE;
-  int size = SINGLE_NODE;
 #ifdef HAVE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &size);
-  unsigned long Local_nElem;
-  unsigned long Local_nElemTri, Local_nElemQuad, Local_nElemTet;
-  unsigned long Local_nElemHex, Local_nElemPrism, Local_nElemPyramid;
-  MPI_Request *send_req, *recv_req;
-  MPI_Status  status;
-  int ind;
 #endif
   
-  /*--- Initialize counters for local/global points & elements ---*/
+  /*--- The binary format holds a single zone and no split actuator disk. ---*/
   
-  Global_nPoint  = 0; Global_nPointDomain = 0; Global_nElem = 0;
+  if ((val_nZone > 1 && !harmonic_balance) || actuator_disk) {
+    if (rank == MASTER_NODE) cout << "Multizone meshes and actuator disks require the SU2 ASCII mesh format!" << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  if (harmonic_balance && (rank == MASTER_NODE))
+    cout << "Reading time instance " << val_iZone+1 << ":" << endl;
+  
+  Global_nPoint  = 0; Global_nPointDomain   = 0; Global_nElem = 0; Global_nElemDomain = 0;
   nelem_edge     = 0; Global_nelem_edge     = 0;
   nelem_triangle = 0; Global_nelem_triangle = 0;
   nelem_quad     = 0; Global_nelem_quad     = 0;
@@ -6935,43 +7034,53 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
   nelem_prism    = 0; Global_nelem_prism    = 0;
   nelem_pyramid  = 0; Global_nelem_pyramid  = 0;
   
-  /*--- Initialize some additional counters for the parallel partitioning ---*/
-  
-  unsigned long total_pt_accounted = 0;
-  unsigned long rem_points         = 0;
-  unsigned long element_count      = 0;
-  unsigned long element_remainder  = 0;
-  unsigned long total_elems        = 0;
-  
-  /*--- Allocate memory for the linear partitioning of the mesh. These
+  /*--- Allocate memory for the linear partition of the mesh. These
    arrays are the size of the number of ranks. ---*/
   
   starting_node = new unsigned long[size];
   ending_node   = new unsigned long[size];
   npoint_procs  = new unsigned long[size];
   
-  unsigned long *nPoint_Linear = new unsigned long[size+1];
-  unsigned long *nElem_Linear  = new unsigned long[size];
+  /*--- Open the grid file on all ranks ---*/
   
-  unsigned long *elemB = new unsigned long[size];
-  unsigned long *elemE = new unsigned long[size];
+#ifdef HAVE_MPI
+  MPI_File mesh_file;
+  char fname[MAX_STRING_SIZE];
+  strcpy(fname, val_mesh_filename.c_str());
+  int ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &mesh_file);
+  bool open_fail = (ierr != MPI_SUCCESS);
+#else
+  ifstream mesh_file;
+  mesh_file.open(val_mesh_filename.c_str(), ios::in | ios::binary);
+  bool open_fail = mesh_file.fail();
+#endif
   
-  unsigned long *elemGlobalID = NULL;
+  if (open_fail) {
+    if (rank == MASTER_NODE) cout << "There is no mesh file (CPhysicalGeometry)!! " << val_mesh_filename << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
   
-  unsigned short *nPoinPerElem = NULL;
-  unsigned short *elemTypes = NULL;
+  /*--- Read the header: identifier, dimension, number of markers and
+   periodic transformations, element, connectivity and point counts,
+   and the AoA/AoS offsets. ---*/
   
-  bool *isMixed = NULL;
+  int header_int[4];
+  unsigned long header_long[4];
+  passivedouble header_double[2];
   
-  unsigned short connSize = 10;
+  offset = 0;
+  Read_Binary_Mesh_Block(mesh_file, offset, header_int, 4*sizeof(int)); offset += 4*sizeof(int);
+  Read_Binary_Mesh_Block(mesh_file, offset, header_long, 4*sizeof(unsigned long)); offset += 4*sizeof(unsigned long);
+  Read_Binary_Mesh_Block(mesh_file, offset, header_double, 2*sizeof(passivedouble)); offset += 2*sizeof(passivedouble);
   
-  /*--- Check whether the supplied file is truly a CGNS file. ---*/
-  if (cg_is_cgns(val_mesh_filename.c_str(), &file_type) != CG_OK) {
-    if (rank == MASTER_NODE) {
-    printf( "\n\n   !!! Error !!!\n" );
-    printf( " %s is not a CGNS file.\n", val_mesh_filename.c_str());
-    printf( " Now exiting...\n\n");
-    }
+  if (header_int[0] != SU2_BINARY_MESH) {
+    if (rank == MASTER_NODE) cout << "The file " << val_mesh_filename << " is not a SU2 binary mesh file!" << endl;
 #ifndef HAVE_MPI
     exit(EXIT_FAILURE);
 #else
@@ -6981,71 +7090,698 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
 #endif
   }
   
-  /*--- Open the CGNS file for reading. The value of fn returned
-   is the specific index number for this file and will be
-   repeatedly used in the function calls. ---*/
+  nDim = header_int[1];
+  nMarker = header_int[2];
+  unsigned short nPeriodic = header_int[3];
+  Global_nElem = header_long[0];
+  unsigned long Global_nConn = header_long[1];
+  Global_nPoint = header_long[2];
+  Global_nPointDomain = header_long[3];
   
-  if (cg_open(val_mesh_filename.c_str(), CG_MODE_READ, &fn)) cg_error_exit();
   if (rank == MASTER_NODE) {
-    cout << "Reading the CGNS file: ";
-    cout << val_mesh_filename.c_str() << "." << endl;
+    if (nDim == 2) cout << "Two dimensional problem." << endl;
+    if (nDim == 3) cout << "Three dimensional problem." << endl;
   }
   
-  /*--- Get the number of databases. This is the highest node
-   in the CGNS heirarchy. ---*/
+  /*--- Apply the offsets in the mesh parameters (in deg), as for the ASCII format. ---*/
   
-  if ( cg_nbases(fn, &nbases) ) cg_error_exit();
-  if (rank == MASTER_NODE)
-    cout << "CGNS file contains " << nbases << " database(s)." << endl;
+  AoA_Offset = header_double[0];
+  AoA_Current = config->GetAoA() + AoA_Offset;
+  if (config->GetDiscard_InFiles() == false) {
+    if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))  {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
+      cout << "         AoA offset in mesh file (" << AoA_Offset << " deg.) = " << AoA_Current << " deg." << endl;
+    }
+    config->SetAoA_Offset(AoA_Offset);
+    config->SetAoA(AoA_Current);
+  }
+  else {
+    if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))
+      cout <<"WARNING: Discarding the AoA offset in the geometry file." << endl;
+  }
   
-  /*--- Check if there is more than one database. Throw an
-   error if there is because this reader can currently
-   only handle one database. ---*/
+  AoS_Offset = header_double[1];
+  AoS_Current = config->GetAoS() + AoS_Offset;
+  if (config->GetDiscard_InFiles() == false) {
+    if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))  {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
+      cout << "         AoS offset in mesh file (" << AoS_Offset << " deg.) = " << AoS_Current << " deg." << endl;
+    }
+    config->SetAoS_Offset(AoS_Offset);
+    config->SetAoS(AoS_Current);
+  }
+  else {
+    if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))
+      cout <<"WARNING: Discarding the AoS offset in the geometry file." << endl;
+  }
   
-  if ( nbases > 1 ) {
-    if (rank == MASTER_NODE) {
-    printf("\n\n   !!! Error !!!\n" );
-    printf("CGNS reader currently incapable of handling more than 1 database.");
-    printf("Now exiting...\n\n");
+  /*--- Offsets of the element types, connectivity, coordinates and markers. ---*/
+  
+  unsigned long offset_type  = offset;
+  unsigned long offset_conn  = offset_type + Global_nElem*sizeof(int);
+  unsigned long offset_coord = offset_conn + Global_nConn*sizeof(unsigned long);
+  unsigned long offset_mark  = offset_coord + Global_nPoint*nDim*sizeof(passivedouble);
+  
+  if (rank == MASTER_NODE) {
+    if (Global_nPoint != Global_nPointDomain) {
+      cout << Global_nPointDomain << " points and " << Global_nPoint-Global_nPointDomain;
+      cout << " ghost points";
+    } else {
+      cout << Global_nPoint << " points";
     }
-#ifndef HAVE_MPI
-    exit(EXIT_FAILURE);
-#else
-    MPI_Barrier(MPI_COMM_WORLD);
-    MPI_Abort(MPI_COMM_WORLD,1);
-    MPI_Finalize();
-#endif
+    if (size > SINGLE_NODE) cout << " before parallel partitioning." << endl;
+    else cout << "." << endl;
   }
   
-  /*--- Read the databases. Note that the CGNS indexing starts at 1. ---*/
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Performing linear partitioning of the grid nodes." << endl;
   
-  for (int i = 1; i <= nbases; i++) {
-    
-    if (cg_base_read(fn, i, basename, &cell_dim, &phys_dim)) cg_error_exit();
-    
-    /*--- Get the number of zones for this base. ---*/
-    
-    if ( cg_nzones(fn, i, &nzones) ) cg_error_exit();
-    if (rank == MASTER_NODE) {
-      cout << "Database " << i << ", " << basename << ": " << nzones;
-      cout << " zone(s), cell dimension of " << cell_dim << ", physical ";
-      cout << "dimension of " << phys_dim << "." << endl;
+  /*--- Linear partitioning of the points with the remainder spread over
+   the first ranks, identical to the ASCII reader. ---*/
+  
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    npoint_procs[iProcessor] = Global_nPoint/size;
+  for (i = 0; i < Global_nPoint-(Global_nPoint/size)*size; i++)
+    npoint_procs[i]++;
+  
+  starting_node[0] = 0;
+  ending_node[0]   = npoint_procs[0];
+  for (iProcessor = 1; iProcessor < size; iProcessor++) {
+    starting_node[iProcessor] = ending_node[iProcessor-1];
+    ending_node[iProcessor]   = starting_node[iProcessor] + npoint_procs[iProcessor];
+  }
+  
+  nPoint = npoint_procs[rank];
+  nPointDomain = Global_nPointDomain;
+  
+  /*--- Each rank reads only the coordinates of its own points. ---*/
+  
+  passivedouble *Coord_Buffer = new passivedouble[nPoint*nDim+1];
+  Read_Binary_Mesh_Block(mesh_file, offset_coord + starting_node[rank]*nDim*sizeof(passivedouble),
+                         Coord_Buffer, nPoint*nDim*sizeof(passivedouble));
+  
+  nPointNode = nPoint;
+  node = new CPoint*[nPoint];
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    if (nDim == 2)
+      node[iPoint] = new CPoint(Coord_Buffer[iPoint*nDim], Coord_Buffer[iPoint*nDim+1],
+                                starting_node[rank]+iPoint, config);
+    else
+      node[iPoint] = new CPoint(Coord_Buffer[iPoint*nDim], Coord_Buffer[iPoint*nDim+1], Coord_Buffer[iPoint*nDim+2],
+                                starting_node[rank]+iPoint, config);
+  }
+  delete [] Coord_Buffer;
+  
+  /*--- Each rank reads a contiguous chunk of the elements. The element
+   chunks are not aligned with the point partition, so every element is
+   then sent to all the ranks that own at least one of its nodes. ---*/
+  
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << Global_nElem << " interior elements before parallel partitioning." << endl;
+  
+  unsigned long nElem_Chunk = Global_nElem/size, first_elem = rank*nElem_Chunk;
+  unsigned long rem_elem = Global_nElem - nElem_Chunk*size;
+  if ((unsigned long)rank < rem_elem) { nElem_Chunk++; first_elem += rank; }
+  else first_elem += rem_elem;
+  
+  int *Elem_Type = new int[nElem_Chunk+1];
+  Read_Binary_Mesh_Block(mesh_file, offset_type + first_elem*sizeof(int), Elem_Type, nElem_Chunk*sizeof(int));
+  
+  unsigned long nConn_Chunk = 0;
+  for (iElem = 0; iElem < nElem_Chunk; iElem++) {
+    switch(Elem_Type[iElem]) {
+      case TRIANGLE:      nConn_Chunk += N_POINTS_TRIANGLE; break;
+      case QUADRILATERAL: nConn_Chunk += N_POINTS_QUADRILATERAL; break;
+      case TETRAHEDRON:   nConn_Chunk += N_POINTS_TETRAHEDRON; break;
+      case HEXAHEDRON:    nConn_Chunk += N_POINTS_HEXAHEDRON; break;
+      case PRISM:         nConn_Chunk += N_POINTS_PRISM; break;
+      case PYRAMID:       nConn_Chunk += N_POINTS_PYRAMID; break;
     }
+  }
+  
+  /*--- The connectivity offset of this chunk is the sum over the lower ranks. ---*/
+  
+  unsigned long first_conn = 0;
+#ifdef HAVE_MPI
+  unsigned long *nConn_Procs = new unsigned long[size];
+  SU2_MPI::Allgather(&nConn_Chunk, 1, MPI_UNSIGNED_LONG, nConn_Procs, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  for (iProcessor = 0; iProcessor < rank; iProcessor++) first_conn += nConn_Procs[iProcessor];
+  delete [] nConn_Procs;
+#endif
+  
+  unsigned long *Elem_Conn = new unsigned long[nConn_Chunk+1];
+  Read_Binary_Mesh_Block(mesh_file, offset_conn + first_conn*sizeof(unsigned long), Elem_Conn, nConn_Chunk*sizeof(unsigned long));
+  
+  /*--- Count and load the messages: the VTK type, the global ID and the
+   connectivity, padded to the size of a hexahedron. ---*/
+  
+  unsigned short connSize = N_POINTS_HEXAHEDRON+2;
+  int *nElem_Send = new int[size+1], *nElem_Recv = new int[size+1];
+  long *nElem_Flag = new long[size];
+  for (iProcessor = 0; iProcessor <= size; iProcessor++) { nElem_Send[iProcessor] = 0; nElem_Recv[iProcessor] = 0; }
+  
+  for (int iPass = 0; iPass < 2; iPass++) {
     
-    /*--- Check if there is more than one zone. Throw an
-     error if there is, because this reader can currently
-     only handle one zone. This could be extended in the future. ---*/
-    
-    if ( nzones > 1 ) {
-      if (rank == MASTER_NODE) {
-      printf("\n\n   !!! Error !!!\n" );
-      printf("CGNS reader currently incapable of handling more than 1 zone.");
-      printf("Now exiting...\n\n");
+    unsigned long *connSend = NULL, *index = NULL;
+    if (iPass == 1) {
+      connSend = new unsigned long[connSize*nElem_Send[size]+1];
+      index = new unsigned long[size];
+      for (iProcessor = 0; iProcessor < size; iProcessor++) index[iProcessor] = connSize*nElem_Send[iProcessor];
+    }
+    for (iProcessor = 0; iProcessor < size; iProcessor++) nElem_Flag[iProcessor] = -1;
+    
+    jNode = 0;
+    for (iElem = 0; iElem < nElem_Chunk; iElem++) {
+      nNodes = 0;
+      switch(Elem_Type[iElem]) {
+        case TRIANGLE:      nNodes = N_POINTS_TRIANGLE; break;
+        case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+        case TETRAHEDRON:   nNodes = N_POINTS_TETRAHEDRON; break;
+        case HEXAHEDRON:    nNodes = N_POINTS_HEXAHEDRON; break;
+        case PRISM:         nNodes = N_POINTS_PRISM; break;
+        case PYRAMID:       nNodes = N_POINTS_PYRAMID; break;
       }
-#ifndef HAVE_MPI
-      exit(EXIT_FAILURE);
-#else
-      MPI_Barrier(MPI_COMM_WORLD);
+      for (iNode = 0; iNode < nNodes; iNode++) {
+        
+        /*--- Search for the processor that owns this point ---*/
+        
+        iPoint = Elem_Conn[jNode+iNode];
+        iProcessor = upper_bound(ending_node, ending_node+size, iPoint) - ending_node;
+        if (iProcessor >= size) iProcessor = size-1;
+        
+        if (nElem_Flag[iProcessor] != (long)iElem) {
+          nElem_Flag[iProcessor] = iElem;
+          if (iPass == 0) nElem_Send[iProcessor+1]++;
+          else {
+            unsigned long nn = index[iProcessor];
+            connSend[nn] = Elem_Type[iElem]; connSend[nn+1] = first_elem+iElem;
+            for (unsigned short kk = 0; kk < connSize-2; kk++)
+              connSend[nn+2+kk] = (kk < nNodes)? Elem_Conn[jNode+kk] : 0;
+            index[iProcessor] += connSize;
+          }
+        }
+      }
+      jNode += nNodes;
+    }
+    
+    if (iPass == 0) {
+      
+      /*--- Exchange the counts and put them in cumulative storage. ---*/
+      
+#ifdef HAVE_MPI
+      MPI_Alltoall(&(nElem_Send[1]), 1, MPI_INT, &(nElem_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+#else
+      nElem_Recv[1] = nElem_Send[1];
+#endif
+      for (iProcessor = 0; iProcessor < size; iProcessor++) {
+        nElem_Send[iProcessor+1] += nElem_Send[iProcessor];
+        nElem_Recv[iProcessor+1] += nElem_Recv[iProcessor];
+      }
+      
+    } else {
+      
+      delete [] Elem_Type;
+      delete [] Elem_Conn;
+      delete [] index;
+      
+      /*--- Exchange the elements. The chunks are ordered by rank, so the
+       received elements are already sorted by their global ID. ---*/
+      
+      unsigned long *connRecv = new unsigned long[connSize*nElem_Recv[size]+1];
+#ifdef HAVE_MPI
+      int *sendCounts = new int[size], *sendDispl = new int[size];
+      int *recvCounts = new int[size], *recvDispl = new int[size];
+      for (iProcessor = 0; iProcessor < size; iProcessor++) {
+        sendCounts[iProcessor] = connSize*(nElem_Send[iProcessor+1]-nElem_Send[iProcessor]);
+        sendDispl[iProcessor]  = connSize*nElem_Send[iProcessor];
+        recvCounts[iProcessor] = connSize*(nElem_Recv[iProcessor+1]-nElem_Recv[iProcessor]);
+        recvDispl[iProcessor]  = connSize*nElem_Recv[iProcessor];
+      }
+      MPI_Alltoallv(connSend, sendCounts, sendDispl, MPI_UNSIGNED_LONG,
+                    connRecv, recvCounts, recvDispl, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+      delete [] sendCounts; delete [] sendDispl;
+      delete [] recvCounts; delete [] recvDispl;
+#else
+      for (i = 0; i < (unsigned long)connSize*nElem_Recv[size]; i++) connRecv[i] = connSend[i];
+#endif
+      delete [] connSend;
+      
+      /*--- Store the local elements and build the adjacency for ParMETIS
+       assuming the VTK connectivity, as in the ASCII reader. ---*/
+      
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+      vector< vector<unsigned long> > adj_nodes(nPoint, vector<unsigned long>(0));
+#endif
+#endif
+      
+      nElem = nElem_Recv[size];
+      elem = new CPrimalGrid*[nElem];
+      Global_to_Local_Elem.clear();
+      
+      if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+        cout << "Distributing elements across all ranks." << endl;
+      
+      for (iElem = 0; iElem < nElem; iElem++) {
+        
+        unsigned long *conn = &connRecv[iElem*connSize];
+        for (iNode = 0; iNode < N_POINTS_HEXAHEDRON; iNode++) vnodes[iNode] = conn[iNode+2];
+        Global_to_Local_Elem[conn[1]] = iElem;
+        
+        switch(conn[0]) {
+          case TRIANGLE:
+            elem[iElem] = new CTriangle(vnodes[0], vnodes[1], vnodes[2], 2);
+            nelem_triangle++; nNodes = N_POINTS_TRIANGLE; break;
+          case QUADRILATERAL:
+            elem[iElem] = new CQuadrilateral(vnodes[0], vnodes[1], vnodes[2], vnodes[3], 2);
+            nelem_quad++; nNodes = N_POINTS_QUADRILATERAL; break;
+          case TETRAHEDRON:
+            elem[iElem] = new CTetrahedron(vnodes[0], vnodes[1], vnodes[2], vnodes[3]);
+            nelem_tetra++; nNodes = N_POINTS_TETRAHEDRON; break;
+          case HEXAHEDRON:
+            elem[iElem] = new CHexahedron(vnodes[0], vnodes[1], vnodes[2], vnodes[3],
+                                          vnodes[4], vnodes[5], vnodes[6], vnodes[7]);
+            nelem_hexa++; nNodes = N_POINTS_HEXAHEDRON; break;
+          case PRISM:
+            elem[iElem] = new CPrism(vnodes[0], vnodes[1], vnodes[2], vnodes[3], vnodes[4], vnodes[5]);
+            nelem_prism++; nNodes = N_POINTS_PRISM; break;
+          case PYRAMID:
+            elem[iElem] = new CPyramid(vnodes[0], vnodes[1], vnodes[2], vnodes[3], vnodes[4]);
+            nelem_pyramid++; nNodes = N_POINTS_PYRAMID; break;
+          default:
+            cout << "Unrecognized element type " << conn[0] << " in the binary mesh file!" << endl;
+#ifndef HAVE_MPI
+            exit(EXIT_FAILURE);
+#else
+            MPI_Abort(MPI_COMM_WORLD,1);
+            MPI_Finalize();
+#endif
+        }
+        
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+        for (unsigned short iLoc = 0; iLoc < nNodes; iLoc++) {
+          local_index = vnodes[iLoc]-starting_node[rank];
+          if ((local_index < 0) || (local_index >= (long)nPoint)) continue;
+          switch(conn[0]) {
+            case TRIANGLE: case TETRAHEDRON:
+              for (unsigned short j = 0; j < nNodes; j++)
+                if (iLoc != j) adj_nodes[local_index].push_back(vnodes[j]);
+              break;
+            case QUADRILATERAL:
+              adj_nodes[local_index].push_back(vnodes[(iLoc+1)%4]);
+              adj_nodes[local_index].push_back(vnodes[(iLoc+3)%4]);
+              break;
+            case HEXAHEDRON:
+              if (iLoc < 4) {
+                adj_nodes[local_index].push_back(vnodes[(iLoc+1)%4]);
+                adj_nodes[local_index].push_back(vnodes[(iLoc+3)%4]);
+              } else {
+                adj_nodes[local_index].push_back(vnodes[(iLoc-3)%4+4]);
+                adj_nodes[local_index].push_back(vnodes[(iLoc-1)%4+4]);
+              }
+              adj_nodes[local_index].push_back(vnodes[(iLoc+4)%8]);
+              break;
+            case PRISM:
+              if (iLoc < 3) {
+                adj_nodes[local_index].push_back(vnodes[(iLoc+1)%3]);
+                adj_nodes[local_index].push_back(vnodes[(iLoc+2)%3]);
+              } else {
+                adj_nodes[local_index].push_back(vnodes[(iLoc-2)%3+3]);
+                adj_nodes[local_index].push_back(vnodes[(iLoc-1)%3+3]);
+              }
+              adj_nodes[local_index].push_back(vnodes[(iLoc+3)%6]);
+              break;
+            case PYRAMID:
+              if (iLoc < 4) {
+                adj_nodes[local_index].push_back(vnodes[(iLoc+1)%4]);
+                adj_nodes[local_index].push_back(vnodes[(iLoc+3)%4]);
+                adj_nodes[local_index].push_back(vnodes[4]);
+              } else {
+                adj_nodes[local_index].push_back(vnodes[0]);
+                adj_nodes[local_index].push_back(vnodes[1]);
+                adj_nodes[local_index].push_back(vnodes[2]);
+                adj_nodes[local_index].push_back(vnodes[3]);
+              }
+              break;
+          }
+        }
+#endif
+#endif
+        
+      }
+      
+      delete [] connRecv;
+      
+      Global_nElemDomain = Global_nElem;
+      
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+      
+      /*--- Sort the adjacency of each local node, remove the repeats and
+       store it in the compressed format expected by ParMETIS. ---*/
+      
+      if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+        cout << "Building the graph adjacency structure." << endl;
+      
+      vector<unsigned long> adjac_vec;
+      vector<unsigned long>::iterator it;
+      xadj = new idx_t [nPoint+1];
+      xadj[0] = 0;
+      for (iPoint = 0; iPoint < nPoint; iPoint++) {
+        sort(adj_nodes[iPoint].begin(), adj_nodes[iPoint].end());
+        it = unique(adj_nodes[iPoint].begin(), adj_nodes[iPoint].end());
+        adj_nodes[iPoint].resize(it - adj_nodes[iPoint].begin());
+        xadj[iPoint+1] = xadj[iPoint] + adj_nodes[iPoint].size();
+        adjac_vec.insert(adjac_vec.end(), adj_nodes[iPoint].begin(), adj_nodes[iPoint].end());
+        adj_nodes[iPoint].clear();
+      }
+      
+      adjacency = new idx_t [xadj[nPoint]];
+      copy(adjac_vec.begin(), adjac_vec.end(), adjacency);
+      xadj_size = nPoint+1;
+      adjacency_size = xadj[nPoint];
+      
+#endif
+#endif
+      
+    }
+  }
+  
+  delete [] nElem_Send;
+  delete [] nElem_Recv;
+  delete [] nElem_Flag;
+  
+  /*--- All ranks read the boundary markers, which follow the coordinates. ---*/
+  
+  if (rank == MASTER_NODE) cout << nMarker << " surface markers." << endl;
+  config->SetnMarker_All(nMarker);
+  bound = new CPrimalGrid**[nMarker];
+  nElem_Bound = new unsigned long [nMarker];
+  Tag_to_Marker = new string [nMarker_Max];
+  
+  offset = offset_mark;
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    
+    char str_buf[CGNS_STRING_SIZE];
+    unsigned long marker_long[2];
+    Read_Binary_Mesh_Block(mesh_file, offset, str_buf, CGNS_STRING_SIZE*sizeof(char));
+    offset += CGNS_STRING_SIZE*sizeof(char);
+    Read_Binary_Mesh_Block(mesh_file, offset, marker_long, 2*sizeof(unsigned long));
+    offset += 2*sizeof(unsigned long);
+    str_buf[CGNS_STRING_SIZE-1] = '\0';
+    string Marker_Tag(str_buf);
+    
+    nElem_Bound[iMarker] = marker_long[0];
+    if (rank == MASTER_NODE)
+      cout << nElem_Bound[iMarker]  << " boundary elements in index "<< iMarker <<" (Marker = " <<Marker_Tag<< ")." << endl;
+    
+    int *Bound_Type = new int[marker_long[0]+1];
+    unsigned long *Bound_Conn = new unsigned long[marker_long[1]+1];
+    Read_Binary_Mesh_Block(mesh_file, offset, Bound_Type, marker_long[0]*sizeof(int));
+    offset += marker_long[0]*sizeof(int);
+    Read_Binary_Mesh_Block(mesh_file, offset, Bound_Conn, marker_long[1]*sizeof(unsigned long));
+    offset += marker_long[1]*sizeof(unsigned long);
+    
+    bound[iMarker] = new CPrimalGrid* [nElem_Bound[iMarker]];
+    
+    jNode = 0;
+    for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+      unsigned long *vn = &Bound_Conn[jNode];
+      switch(Bound_Type[iElem_Bound]) {
+        case LINE:
+          if (nDim == 3) {
+            cout << "Please remove line boundary conditions from the mesh file!" << endl;
+#ifndef HAVE_MPI
+            exit(EXIT_FAILURE);
+#else
+            MPI_Barrier(MPI_COMM_WORLD);
+            MPI_Abort(MPI_COMM_WORLD,1);
+            MPI_Finalize();
+#endif
+          }
+          bound[iMarker][iElem_Bound] = new CLine(vn[0], vn[1], 2);
+          jNode += N_POINTS_LINE; break;
+        case TRIANGLE:
+          bound[iMarker][iElem_Bound] = new CTriangle(vn[0], vn[1], vn[2], 3);
+          jNode += N_POINTS_TRIANGLE; break;
+        case QUADRILATERAL:
+          bound[iMarker][iElem_Bound] = new CQuadrilateral(vn[0], vn[1], vn[2], vn[3], 3);
+          jNode += N_POINTS_QUADRILATERAL; break;
+      }
+    }
+    
+    delete [] Bound_Type;
+    delete [] Bound_Conn;
+    
+    /*--- Update config information storing the boundary information in the right place ---*/
+    
+    Tag_to_Marker[config->GetMarker_CfgFile_TagBound(Marker_Tag)] = Marker_Tag;
+    config->SetMarker_All_TagBound(iMarker, Marker_Tag);
+    config->SetMarker_All_KindBC(iMarker, config->GetMarker_CfgFile_KindBC(Marker_Tag));
+    config->SetMarker_All_Monitoring(iMarker, config->GetMarker_CfgFile_Monitoring(Marker_Tag));
+    config->SetMarker_All_GeoEval(iMarker, config->GetMarker_CfgFile_GeoEval(Marker_Tag));
+    config->SetMarker_All_Designing(iMarker, config->GetMarker_CfgFile_Designing(Marker_Tag));
+    config->SetMarker_All_Plotting(iMarker, config->GetMarker_CfgFile_Plotting(Marker_Tag));
+    config->SetMarker_All_Analyze(iMarker, config->GetMarker_CfgFile_Analyze(Marker_Tag));
+    config->SetMarker_All_FSIinterface(iMarker, config->GetMarker_CfgFile_FSIinterface(Marker_Tag));
+    config->SetMarker_All_DV(iMarker, config->GetMarker_CfgFile_DV(Marker_Tag));
+    config->SetMarker_All_Moving(iMarker, config->GetMarker_CfgFile_Moving(Marker_Tag));
+    config->SetMarker_All_PerBound(iMarker, config->GetMarker_CfgFile_PerBound(Marker_Tag));
+    config->SetMarker_All_SendRecv(iMarker, NONE);
+    config->SetMarker_All_Out_1D(iMarker, config->GetMarker_CfgFile_Out_1D(Marker_Tag));
+    
+  }
+  
+  /*--- Read the periodic transformations (center, rotation, translation),
+   or store default zeros if there are none. ---*/
+  
+  su2double center[3], rotation[3], translate[3];
+  if (nPeriodic > 0) {
+    if ((rank == MASTER_NODE) && (nPeriodic - 1 != 0))
+      cout << nPeriodic - 1 << " periodic transformations." << endl;
+    config->SetnPeriodicIndex(nPeriodic);
+    for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+      passivedouble periodic_buf[9];
+      Read_Binary_Mesh_Block(mesh_file, offset, periodic_buf, 9*sizeof(passivedouble));
+      offset += 9*sizeof(passivedouble);
+      for (iDim = 0; iDim < 3; iDim++) {
+        center[iDim] = periodic_buf[iDim]; rotation[iDim] = periodic_buf[iDim+3]; translate[iDim] = periodic_buf[iDim+6];
+      }
+      config->SetPeriodicCenter(iPeriodic, center);
+      config->SetPeriodicRotation(iPeriodic, rotation);
+      config->SetPeriodicTranslate(iPeriodic, translate);
+    }
+  }
+  else {
+    config->SetnPeriodicIndex(1);
+    for (iDim = 0; iDim < 3; iDim++) {
+      center[iDim] = 0.0; rotation[iDim] = 0.0; translate[iDim] = 0.0;
+    }
+    config->SetPeriodicCenter(0, center);
+    config->SetPeriodicRotation(0, rotation);
+    config->SetPeriodicTranslate(0, translate);
+  }
+  
+  /*--- Close the input file ---*/
+  
+#ifdef HAVE_MPI
+  MPI_File_close(&mesh_file);
+#else
+  mesh_file.close();
+#endif
+  
+}
+
+void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
+  
+  /*--- Original CGNS reader implementation by Thomas D. Economon,
+   Francisco Palacios. Improvements for mixed-element meshes generated
+   by ICEM added by Martin Spel (3D) & Shlomy Shitrit (2D), April 2014.
+   Parallel version by Thomas D. Economon, February 2015. ---*/
+  
+#ifdef HAVE_CGNS
+    
+  string text_line, Marker_Tag;
+  ifstream mesh_file;
+  unsigned short VTK_Type = 0, iMarker = 0;
+  unsigned short nMarker_Max = config->GetnMarker_Max();
+  unsigned long iPoint = 0, iProcessor = 0, ielem = 0, GlobalIndex = 0;
+  unsigned long globalOffset = 0;
+  nZone = val_nZone;
+  
+  /*--- Local variables needed when calling the CGNS mid-level API. ---*/
+  
+  unsigned long vnodes_cgns[8] = {0,0,0,0,0,0,0,0};
+  su2double Coord_cgns[3] = {0.0,0.0,0.0};
+  int fn, nbases = 0, nzones = 0, ngrids = 0, ncoords = 0, nsections = 0;
+  int *vertices = NULL, *cells = NULL, nMarkers = 0, *boundVerts = NULL, npe;
+  int interiorElems = 0, totalVerts = 0;
+  int cell_dim = 0, phys_dim = 0, nbndry, parent_flag, file_type;
+  char basename[CGNS_STRING_SIZE], zonename[CGNS_STRING_SIZE];
+  char coordname[CGNS_STRING_SIZE];
+  cgsize_t* cgsize; cgsize = new cgsize_t[3];
+  ZoneType_t zonetype;
+  DataType_t datatype;
+  passivedouble** coordArray = NULL;
+  passivedouble*** gridCoords = NULL;
+  ElementType_t elemType;
+  cgsize_t range_min, range_max, startE, endE;
+  range_min = 1;
+  string currentElem;
+  int** elemTypeVTK = NULL;
+  int** elemIndex = NULL;
+  int** elemBegin = NULL;
+  int** elemEnd = NULL;
+  int** nElems = NULL;
+  cgsize_t**** connElems = NULL;
+  cgsize_t* connElemCGNS = NULL;
+  cgsize_t* connElemTemp = NULL;
+  cgsize_t ElementDataSize = 0;
+  cgsize_t* parentData = NULL;
+  int** dataSize = NULL;
+  bool** isInternal = NULL;
+  char*** sectionNames = NULL;
+  
+  /*--- Initialize counters for local/global points & elements ---*/
+  
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  unsigned long Local_nElem;
+  unsigned long Local_nElemTri, Local_nElemQuad, Local_nElemTet;
+  unsigned long Local_nElemHex, Local_nElemPrism, Local_nElemPyramid;
+  MPI_Request *send_req, *recv_req;
+  MPI_Status  status;
+  int ind;
+#endif
+  
+  /*--- Initialize counters for local/global points & elements ---*/
+  
+  Global_nPoint  = 0; Global_nPointDomain = 0; Global_nElem = 0;
+  nelem_edge     = 0; Global_nelem_edge     = 0;
+  nelem_triangle = 0; Global_nelem_triangle = 0;
+  nelem_quad     = 0; Global_nelem_quad     = 0;
+  nelem_tetra    = 0; Global_nelem_tetra    = 0;
+  nelem_hexa     = 0; Global_nelem_hexa     = 0;
+  nelem_prism    = 0; Global_nelem_prism    = 0;
+  nelem_pyramid  = 0; Global_nelem_pyramid  = 0;
+  
+  /*--- Initialize some additional counters for the parallel partitioning ---*/
+  
+  unsigned long total_pt_accounted = 0;
+  unsigned long rem_points         = 0;
+  unsigned long element_count      = 0;
+  unsigned long element_remainder  = 0;
+  unsigned long total_elems        = 0;
+  
+  /*--- Allocate memory for the linear partitioning of the mesh. These
+   arrays are the size of the number of ranks. ---*/
+  
+  starting_node = new unsigned long[size];
+  ending_node   = new unsigned long[size];
+  npoint_procs  = new unsigned long[size];
+  
+  unsigned long *nPoint_Linear = new unsigned long[size+1];
+  unsigned long *nElem_Linear  = new unsigned long[size];
+  
+  unsigned long *elemB = new unsigned long[size];
+  unsigned long *elemE = new unsigned long[size];
+  
+  unsigned long *elemGlobalID = NULL;
+  
+  unsigned short *nPoinPerElem = NULL;
+  unsigned short *elemTypes = NULL;
+  
+  bool *isMixed = NULL;
+  
+  unsigned short connSize = 10;
+  
+  /*--- Check whether the supplied file is truly a CGNS file. ---*/
+  if (cg_is_cgns(val_mesh_filename.c_str(), &file_type) != CG_OK) {
+    if (rank == MASTER_NODE) {
+    printf( "\n\n   !!! Error !!!\n" );
+    printf( " %s is not a CGNS file.\n", val_mesh_filename.c_str());
+    printf( " Now exiting...\n\n");
+    }
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  /*--- Open the CGNS file for reading. The value of fn returned
+   is the specific index number for this file and will be
+   repeatedly used in the function calls. ---*/
+  
+  if (cg_open(val_mesh_filename.c_str(), CG_MODE_READ, &fn)) cg_error_exit();
+  if (rank == MASTER_NODE) {
+    cout << "Reading the CGNS file: ";
+    cout << val_mesh_filename.c_str() << "." << endl;
+  }
+  
+  /*--- Get the number of databases. This is the highest node
+   in the CGNS heirarchy. ---*/
+  
+  if ( cg_nbases(fn, &nbases) ) cg_error_exit();
+  if (rank == MASTER_NODE)
+    cout << "CGNS file contains " << nbases << " database(s)." << endl;
+  
+  /*--- Check if there is more than one database. Throw an
+   error if there is because this reader can currently
+   only handle one database. ---*/
+  
+  if ( nbases > 1 ) {
+    if (rank == MASTER_NODE) {
+    printf("\n\n   !!! Error !!!\n" );
+    printf("CGNS reader currently incapable of handling more than 1 database.");
+    printf("Now exiting...\n\n");
+    }
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  /*--- Read the databases. Note that the CGNS indexing starts at 1. ---*/
+  
+  for (int i = 1; i <= nbases; i++) {
+    
+    if (cg_base_read(fn, i, basename, &cell_dim, &phys_dim)) cg_error_exit();
+    
+    /*--- Get the number of zones for this base. ---*/
+    
+    if ( cg_nzones(fn, i, &nzones) ) cg_error_exit();
+    if (rank == MASTER_NODE) {
+      cout << "Database " << i << ", " << basename << ": " << nzones;
+      cout << " zone(s), cell dimension of " << cell_dim << ", physical ";
+      cout << "dimension of " << phys_dim << "." << endl;
+    }
+    
+    /*--- Check if there is more than one zone. Throw an
+     error if there is, because this reader can currently
+     only handle one zone. This could be extended in the future. ---*/
+    
+    if ( nzones > 1 ) {
+      if (rank == MASTER_NODE) {
+      printf("\n\n   !!! Error !!!\n" );
+      printf("CGNS reader currently incapable of handling more than 1 zone.");
+      printf("Now exiting...\n\n");
+      }
+#ifndef HAVE_MPI
+      exit(EXIT_FAILURE);
+#else
+      MPI_Barrier(MPI_COMM_WORLD);
       MPI_Abort(MPI_COMM_WORLD,1);
       MPI_Finalize();
 #endif
@@ -9198,9 +9934,9 @@ void CPhysicalGeometry::SetPoint_Connectivity(void) {
 }
 
 void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
-  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iElem, iNode, jNode;
+  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iNode, jNode;
   vector<unsigned long> Queue, AuxQueue, Result;
-  unsigned short Degree, MinDegree, iDim, iMarker;
+  unsigned short Degree, MinDegree;
   bool *inQueue;
   
   inQueue = new bool [nPoint];
@@ -9288,6 +10024,109 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
     Result.push_back(iPoint);
   }
   
+  /*--- Apply the new ordering ---*/
+  
+  SetPoint_Renumbering(config, Result);
+  
+}
+
+void CPhysicalGeometry::SetSFC_Ordering(CConfig *config) {
+  unsigned long iPoint, iBit, nBits;
+  unsigned short iDim, jDim;
+  su2double Coord;
+  vector<unsigned long> Result;
+  
+  bool hilbert = (config->GetKind_Point_Ordering() == HILBERT_POINT_ORDERING);
+  
+  /*--- Number of bits per direction, such that the key fits in 64 bits ---*/
+  
+  nBits = (nDim == 2) ? 31 : 21;
+  const unsigned long long MaxInt = (1ULL << nBits) - 1;
+  
+  /*--- Bounding box of the domain points ---*/
+  
+  su2double Coord_Min[3] = {0.0, 0.0, 0.0}, Coord_Max[3] = {0.0, 0.0, 0.0};
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Coord_Min[iDim] =  1E30;
+    Coord_Max[iDim] = -1E30;
+  }
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Coord = node[iPoint]->GetCoord(iDim);
+      if (Coord < Coord_Min[iDim]) Coord_Min[iDim] = Coord;
+      if (Coord > Coord_Max[iDim]) Coord_Max[iDim] = Coord;
+    }
+  }
+  
+  /*--- Compute the curve key of each domain point ---*/
+  
+  vector<pair<unsigned long long, unsigned long> > Key(nPointDomain);
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    
+    /*--- Quantize the coordinates on the bounding box ---*/
+    
+    unsigned long long X[3] = {0, 0, 0};
+    for (iDim = 0; iDim < nDim; iDim++) {
+      su2double Delta = Coord_Max[iDim] - Coord_Min[iDim];
+      if (Delta > EPS) {
+        double Scaled = SU2_TYPE::GetValue((node[iPoint]->GetCoord(iDim) - Coord_Min[iDim])/Delta);
+        X[iDim] = (unsigned long long)(Scaled*double(MaxInt));
+        if (X[iDim] > MaxInt) X[iDim] = MaxInt;
+      }
+    }
+    
+    /*--- Hilbert curve, transform the axes into the transposed Hilbert
+     index (J. Skilling, "Programming the Hilbert curve", 2004) ---*/
+    
+    if (hilbert) {
+      unsigned long long M = 1ULL << (nBits-1), P, Q, T;
+      for (Q = M; Q > 1; Q >>= 1) {
+        P = Q - 1;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          if (X[iDim] & Q) X[0] ^= P;
+          else { T = (X[0] ^ X[iDim]) & P; X[0] ^= T; X[iDim] ^= T; }
+        }
+      }
+      for (iDim = 1; iDim < nDim; iDim++) X[iDim] ^= X[iDim-1];
+      T = 0;
+      for (Q = M; Q > 1; Q >>= 1)
+        if (X[nDim-1] & Q) T ^= Q - 1;
+      for (iDim = 0; iDim < nDim; iDim++) X[iDim] ^= T;
+    }
+    
+    /*--- Interleave the bits, most significant first ---*/
+    
+    unsigned long long CurveKey = 0;
+    for (iBit = nBits; iBit > 0; iBit--)
+      for (jDim = 0; jDim < nDim; jDim++)
+        CurveKey = (CurveKey << 1) | ((X[jDim] >> (iBit-1)) & 1ULL);
+    
+    Key[iPoint] = make_pair(CurveKey, iPoint);
+    
+  }
+  
+  /*--- Sort the domain points along the curve (ties keep the old order) ---*/
+  
+  sort(Key.begin(), Key.end());
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Result.push_back(Key[iPoint].second);
+  
+  /*--- Add the MPI points ---*/
+  
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    Result.push_back(iPoint);
+  }
+  
+  SetPoint_Renumbering(config, Result);
+  
+}
+
+void CPhysicalGeometry::SetPoint_Renumbering(CConfig *config, vector<unsigned long> &Result) {
+  unsigned long iPoint, iElem, iNode;
+  unsigned short iDim, iMarker;
+  
   /*--- Reset old data structures ---*/
   
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
@@ -9372,6 +10211,24 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
   }
   
   
+  /*--- Keep the local-global maps consistent with the new numbering, they
+   are used to map restart and FIML design variables to the local points ---*/
+  
+  if (Local_to_Global_Point != NULL) {
+    long *AuxLocal_to_Global = new long [nPoint];
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      AuxLocal_to_Global[iPoint] = Local_to_Global_Point[Result[iPoint]];
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      Local_to_Global_Point[iPoint] = AuxLocal_to_Global[iPoint];
+    delete [] AuxLocal_to_Global;
+  }
+  
+  if ((Local_to_Global_Point != NULL) && (!Global_to_Local_Point.empty())) {
+    Global_to_Local_Point.clear();
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      Global_to_Local_Point[Local_to_Global_Point[iPoint]] = iPoint;
+  }
+  
   delete[] InvResult;
   
 }
@@ -11491,26 +12348,34 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
     
     idx_t *vtxdist = new idx_t[size+1];
     idx_t *part    = new idx_t[nPoint];
+    idx_t *vwgt    = NULL;
     
-    real_t ubvec;
-    real_t *tpwgts = new real_t[size];
+    bool weighted = (config->GetKind_Partition_Weights() != UNIFORM_PARTITION_WEIGHTS);
     
-    /*--- Some recommended defaults for the various ParMETIS options. ---*/
+    /*--- Some recommended defaults for the various ParMETIS options. With
+     vertex weights, the point count and the work are balanced together
+     (multi-constraint partitioning). ---*/
     
-    wgtflag = 0;
+    wgtflag = (weighted ? 2 : 0);
     numflag = 0;
-    ncon    = 1;
-    ubvec   = 1.05;
+    ncon    = (weighted ? 2 : 1);
     nparts  = (idx_t)size;
     idx_t options[METIS_NOPTIONS];
     METIS_SetDefaultOptions(options);
     options[1] = 0;
     
+    real_t *ubvec  = new real_t[ncon];
+    real_t *tpwgts = new real_t[ncon*size];
+    
     /*--- Fill the necessary ParMETIS data arrays. Note that xadj_size and
      adjacency_size are class data members that have been defined and set
      earlier in the partitioning process. ---*/
     
-    for (int i = 0; i < size; i++) {
+    for (int i = 0; i < ncon; i++) {
+      ubvec[i] = 1.05;
+    }
+    
+    for (int i = 0; i < ncon*size; i++) {
       tpwgts[i] = 1.0/((real_t)size);
     }
     
@@ -11519,10 +12384,33 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
       vtxdist[i+1] = (idx_t)ending_node[i];
     }
     
+    /*--- Integer vertex weights, scaled such that the average work is
+     close to 10 (enough resolution without overflowing the total). ---*/
+    
+    if (weighted) {
+      
+      vector<su2double> Weight;
+      SetPartition_Weights(config, Weight);
+      
+      su2double MyTotal_Weight = 0.0, Total_Weight = 0.0;
+      unsigned long Total_nPoint = ending_node[size-1];
+      for (iPoint = 0; iPoint < nPoint; iPoint++)
+        MyTotal_Weight += Weight[iPoint];
+      SU2_MPI::Allreduce(&MyTotal_Weight, &Total_Weight, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+      su2double Scale = 10.0*su2double(Total_nPoint)/Total_Weight;
+      
+      vwgt = new idx_t[ncon*nPoint];
+      for (iPoint = 0; iPoint < nPoint; iPoint++) {
+        vwgt[ncon*iPoint]   = 1;
+        vwgt[ncon*iPoint+1] = max((idx_t)1, (idx_t)SU2_TYPE::Int(Weight[iPoint]*Scale + 0.5));
+      }
+      
+    }
+    
     /*--- Calling ParMETIS ---*/
     if (rank == MASTER_NODE) cout << "Calling ParMETIS..." << endl;
-    ParMETIS_V3_PartKway(vtxdist,xadj, adjacency, NULL, NULL, &wgtflag,
-                         &numflag, &ncon, &nparts, tpwgts, &ubvec, options,
+    ParMETIS_V3_PartKway(vtxdist,xadj, adjacency, vwgt, NULL, &wgtflag,
+                         &numflag, &ncon, &nparts, tpwgts, ubvec, options,
                          &edgecut, part, &comm);
     if (rank == MASTER_NODE) {
       cout << "Finished partitioning using ParMETIS (";
@@ -11542,17 +12430,146 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
     delete [] vtxdist;
     delete [] part;
     delete [] tpwgts;
+    delete [] ubvec;
+    if (vwgt != NULL) delete [] vwgt;
+    
+  }
+  
+  /*--- Delete the memory from the geometry class that carried the
+   adjacency structure. ---*/
+  
+  delete [] xadj;
+  delete [] adjacency;
+  
+#endif
+#endif
+  
+}
+
+void CPhysicalGeometry::SetPartition_Weights(CConfig *config, vector<su2double> &val_weight) {
+  
+  unsigned long iPoint, iElem, GlobalIndex, nMissing = 0;
+  unsigned short iMarker, iNode;
+  int rank = MASTER_NODE;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- Points of the initial linear partition, the global index of local
+   point iPoint is starting_node[rank] + iPoint. ---*/
+  
+  val_weight.assign(nPoint, 1.0);
+  
+  if (config->GetKind_Partition_Weights() == ESTIMATED_PARTITION_WEIGHTS) {
+    
+    su2double Weight_Edge     = config->GetPartition_Weight_Edge();
+    su2double Weight_Boundary = config->GetPartition_Weight_Boundary();
+    
+    /*--- Work of the edge loops, from the graph adjacency ---*/
+    
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      val_weight[iPoint] += Weight_Edge*su2double(xadj[iPoint+1]-xadj[iPoint]);
+#endif
+#endif
+    
+    /*--- Work of the boundary conditions, all the ranks hold the complete
+     boundary elements at this point (global numbering) ---*/
+    
+    vector<bool> Boundary(nPoint, false);
+    for (iMarker = 0; iMarker < nMarker; iMarker++) {
+      for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+        for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+          GlobalIndex = bound[iMarker][iElem]->GetNode(iNode);
+          if ((GlobalIndex >= starting_node[rank]) && (GlobalIndex < ending_node[rank]))
+            Boundary[GlobalIndex-starting_node[rank]] = true;
+        }
+      }
+    }
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      if (Boundary[iPoint]) val_weight[iPoint] += Weight_Boundary;
     
   }
   
-  /*--- Delete the memory from the geometry class that carried the
-   adjacency structure. ---*/
+  else if (config->GetKind_Partition_Weights() == MEASURED_PARTITION_WEIGHTS) {
+    
+    /*--- Each rank keeps the entries of its own range of global indices ---*/
+    
+    string filename = config->GetPartition_Weight_FileName(), text_line;
+    ifstream weight_file;
+    weight_file.open(filename.c_str(), ios::in);
+    if (weight_file.fail()) {
+      if (rank == MASTER_NODE)
+        cout << "There is no partition weights file (" << filename << "), using uniform weights." << endl;
+      return;
+    }
+    
+    vector<bool> Found(nPoint, false);
+    su2double Weight;
+    while (getline(weight_file, text_line)) {
+      istringstream point_line(text_line);
+      if (!(point_line >> GlobalIndex >> Weight)) continue;
+      if ((GlobalIndex >= starting_node[rank]) && (GlobalIndex < ending_node[rank])) {
+        val_weight[GlobalIndex-starting_node[rank]] = Weight;
+        Found[GlobalIndex-starting_node[rank]] = true;
+      }
+    }
+    weight_file.close();
+    
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      if (!Found[iPoint]) nMissing++;
+    if (nMissing != 0)
+      cout << "Rank " << rank << ": " << nMissing << " points without a measured weight, using 1.0." << endl;
+    
+  }
+  
+}
+
+void CPhysicalGeometry::SetPartition_WeightsFile(CConfig *config, su2double val_cost) {
+  
+  unsigned long iPoint, nPointDomain_Total = nPointDomain;
+  su2double Total_Cost = val_cost*su2double(nPointDomain), Mean_Cost;
+  ofstream weight_file;
+  string filename = config->GetPartition_Weight_FileName();
+  int iProcessor, rank = MASTER_NODE, size = SINGLE_NODE;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  su2double MyTotal_Cost = Total_Cost;
+  unsigned long MynPointDomain = nPointDomain;
+  SU2_MPI::Allreduce(&MyTotal_Cost, &Total_Cost, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MynPointDomain, &nPointDomain_Total, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  
+  /*--- The weights are normalized with the mean work per point ---*/
+  
+  Mean_Cost = Total_Cost/su2double(nPointDomain_Total);
+  if (Mean_Cost <= 0.0) Mean_Cost = 1.0;
+  
+  if (rank == MASTER_NODE) {
+    cout << "Writing the partition weights file (" << filename << ")." << endl;
+    weight_file.open(filename.c_str(), ios::out);
+    weight_file.close();
+  }
   
-  delete [] xadj;
-  delete [] adjacency;
+  /*--- Write the file processor by processor, the global index is the one
+   of the input mesh, which defines the initial linear partition ---*/
   
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    if (rank == iProcessor) {
+      weight_file.open(filename.c_str(), ios::out | ios::app);
+      weight_file.precision(6);
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+        weight_file << node[iPoint]->GetGlobalIndex() << "\t" << val_cost/Mean_Cost << "\n";
+      weight_file.close();
+    }
+#ifdef HAVE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
 #endif
-#endif
+  }
   
 }
 
@@ -13749,34 +14766,18 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
   
   /*--- Local variables ---*/
   
-  unsigned long iPoint, Index_CoarseCV, CVPoint, iElem, iVertex, jPoint, iteration, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector, iParent, jVertex, *Buffer_Receive_Parent = NULL, *Buffer_Send_Parent = NULL, *Buffer_Receive_Children = NULL, *Buffer_Send_Children = NULL, *Parent_Remote = NULL, *Children_Remote = NULL, *Parent_Local = NULL, *Children_Local = NULL, Local_nPointCoarse, Local_nPointFine, Global_nPointCoarse, Global_nPointFine;;
-  short marker_seed;
-  bool agglomerate_seed = true;
-  unsigned short nChildren, iNode, counter, iMarker, jMarker, priority, MarkerS, MarkerR, *nChildren_MPI;
-  vector<unsigned long> Suitable_Indirect_Neighbors, Aux_Parent;
-  vector<unsigned long>::iterator it;
+  unsigned long iPoint, iElem, Local_nPointCoarse, Local_nPointFine, Global_nPointCoarse, Global_nPointFine;
+  unsigned short iNode;
   int rank;
-
-  unsigned short nMarker_Max = config->GetnMarker_Max();
-
-  unsigned short *copy_marker = new unsigned short [nMarker_Max];
   
 #ifndef HAVE_MPI
   rank = MASTER_NODE;
 #else
-  int send_to, receive_from;
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  MPI_Status status;
 #endif
   
   nDim = fine_grid->GetnDim(); // Write the number of dimensions of the coarse grid.
   
-  /*--- Create a queue system to deo the agglomeration
-   1st) More than two markers ---> Vertices (never agglomerate)
-   2nd) Two markers ---> Edges (agglomerate if same BC, never agglomerate if different BC)
-   3rd) One marker ---> Surface (always agglomarate)
-   4th) No marker ---> Internal Volume (always agglomarate) ---*/
-  
   /*--- Set a marker to indicate indirect agglomeration ---*/
   
   if (iMesh == MESH_1) {
@@ -13798,8 +14799,6 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
   
   /*--- Create the coarse grid structure using as baseline the fine grid ---*/
   
-  CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
- 
   nPointNode = fine_grid->GetnPoint(); 
   node = new CPoint*[fine_grid->GetnPoint()];
   for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
@@ -13813,6 +14812,88 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
     node[iPoint]->SetAgglomerate_Indirect(false);
   }
   
+  /*--- Reuse the agglomeration stored by a previous run, if it was computed
+   for the same fine grid and partition, otherwise agglomerate the fine grid ---*/
+  
+  if (!(config->GetMG_Agglomeration_Cache() && ReadAgglomeration_Cache(fine_grid, config, iMesh))) {
+    
+    SetAgglomeration(fine_grid, config);
+    
+    if (config->GetMG_Agglomeration_Cache())
+      WriteAgglomeration_Cache(fine_grid, config, iMesh);
+    
+  }
+  
+  /*--- Console output with the summary of the agglomeration ---*/
+  
+  Local_nPointCoarse = nPoint;
+  Local_nPointFine = fine_grid->GetnPoint();
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#else
+  Global_nPointCoarse = Local_nPointCoarse;
+  Global_nPointFine = Local_nPointFine;
+#endif
+  
+  su2double Coeff = 1.0, CFL = 0.0, factor = 1.5;
+  
+  if (iMesh != MESH_0) {
+    if (nDim == 2) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./2.);
+    if (nDim == 3) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./3.);
+    CFL = factor*config->GetCFL(iMesh-1)/Coeff;
+    config->SetCFL(iMesh, CFL);
+  }
+  
+  su2double ratio = su2double(Global_nPointFine)/su2double(Global_nPointCoarse);
+  
+  if (((nDim == 2) && (ratio < 2.5)) ||
+      ((nDim == 3) && (ratio < 2.5))) {
+    config->SetMGLevels(iMesh-1);
+  }
+  else {
+    if (rank == MASTER_NODE) {
+      if (iMesh == 1) cout <<"MG level: "<< iMesh-1 <<" -> CVs: " << Global_nPointFine << ". Agglomeration rate 1/1.00. CFL "<< config->GetCFL(iMesh-1) <<"." << endl;
+      cout <<"MG level: "<< iMesh <<" -> CVs: " << Global_nPointCoarse << ". Agglomeration rate 1/" << ratio <<". CFL "<< CFL <<"." << endl;
+    }
+  }
+  
+}
+
+
+CMultiGridGeometry::~CMultiGridGeometry(void) {
+  
+}
+
+void CMultiGridGeometry::SetAgglomeration(CGeometry *fine_grid, CConfig *config) {
+  
+  unsigned long iPoint, Index_CoarseCV, CVPoint, iVertex, jPoint, iteration, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector, iParent, *Buffer_Receive_Parent = NULL, *Buffer_Send_Parent = NULL, *Buffer_Receive_Children = NULL, *Buffer_Send_Children = NULL, *Parent_Remote = NULL, *Children_Remote = NULL, *Parent_Local = NULL, *Children_Local = NULL;
+  short marker_seed;
+  bool agglomerate_seed = true;
+  unsigned short nChildren, iNode, counter, iMarker, jMarker, priority, MarkerS, MarkerR, *nChildren_MPI;
+  vector<unsigned long> Suitable_Indirect_Neighbors, Aux_Parent;
+  vector<unsigned long>::iterator it;
+  
+  unsigned short nMarker_Max = config->GetnMarker_Max();
+  
+  unsigned short *copy_marker = new unsigned short [nMarker_Max];
+  
+#ifdef HAVE_MPI
+  int send_to, receive_from;
+  MPI_Status status;
+#endif
+  
+  /*--- Create a queue system to deo the agglomeration
+   1st) More than two markers ---> Vertices (never agglomerate)
+   2nd) Two markers ---> Edges (agglomerate if same BC, never agglomerate if different BC)
+   3rd) One marker ---> Surface (always agglomarate)
+   4th) No marker ---> Internal Volume (always agglomarate). The agglomeration
+   only involves the points of this partition, the halo points are agglomerated
+   afterwards as in the donor partition. ---*/
+  
+  CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
+  
   Index_CoarseCV = 0;
   
   /*--- The first step is the boundary agglomeration. ---*/
@@ -14274,14 +15355,10 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
         
         Parent_Remote[iVertex] = Buffer_Receive_Parent[iVertex];
         
-        /*--- We use the same sorting as in the donor domain ---*/
+        /*--- We use the same sorting as in the donor domain (Aux_Parent is sorted) ---*/
         
-        for (jVertex = 0; jVertex < Aux_Parent.size(); jVertex++) {
-          if (Parent_Remote[iVertex] == Aux_Parent[jVertex]) {
-            Parent_Local[iVertex] = jVertex + Index_CoarseCV;
-            break;
-          }
-        }
+        it = lower_bound(Aux_Parent.begin(), Aux_Parent.end(), Parent_Remote[iVertex]);
+        Parent_Local[iVertex] = (it - Aux_Parent.begin()) + Index_CoarseCV;
         
         Children_Remote[iVertex] = Buffer_Receive_Children[iVertex];
         Children_Local[iVertex] = fine_grid->vertex[MarkerR][iVertex]->GetNode();
@@ -14329,50 +15406,200 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
   
   nPoint = Index_CoarseCV;
   
-  /*--- Console output with the summary of the agglomeration ---*/
+  delete [] copy_marker;
   
-  Local_nPointCoarse = nPoint;
-  Local_nPointFine = fine_grid->GetnPoint();
+}
+string CMultiGridGeometry::GetAgglomeration_CacheFile(CConfig *config, unsigned short iMesh) {
   
+  int rank = MASTER_NODE, size = SINGLE_NODE;
 #ifdef HAVE_MPI
-  SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-#else
-  Global_nPointCoarse = Local_nPointCoarse;
-  Global_nPointFine = Local_nPointFine;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
 #endif
   
-  su2double Coeff = 1.0, CFL = 0.0, factor = 1.5;
+  /*--- One file per level and per partition, the agglomeration is local to each rank ---*/
   
-  if (iMesh != MESH_0) {
-    if (nDim == 2) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./2.);
-    if (nDim == 3) Coeff = pow(su2double(Global_nPointFine)/su2double(Global_nPointCoarse), 1./3.);
-    CFL = factor*config->GetCFL(iMesh-1)/Coeff;
-    config->SetCFL(iMesh, CFL);
+  stringstream filename;
+  filename << config->GetMG_Cache_FileName() << "_" << iMesh;
+  if (size > SINGLE_NODE) filename << "_" << rank << "_" << size;
+  filename << ".dat";
+  
+  return filename.str();
+  
+}
+
+unsigned long CMultiGridGeometry::GetAgglomeration_Signature(CGeometry *fine_grid) {
+  
+  unsigned long iPoint, iVertex, Signature = 14695981039346656037UL;
+  unsigned short iNode, iMarker;
+  
+  /*--- FNV-1a hash of the fine grid connectivity, partition and
+   boundary definition (everything that drives the agglomeration) ---*/
+  
+  vector<unsigned long> Key;
+  Key.push_back(nDim);
+  Key.push_back(fine_grid->GetnPoint());
+  Key.push_back(fine_grid->GetnPointDomain());
+  Key.push_back(fine_grid->GetnMarker());
+  
+  for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint++) {
+    Key.push_back(fine_grid->node[iPoint]->GetnPoint());
+    Key.push_back(fine_grid->node[iPoint]->GetDomain());
+    Key.push_back(fine_grid->node[iPoint]->GetAgglomerate_Indirect());
+    for (iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode++)
+      Key.push_back(fine_grid->node[iPoint]->GetPoint(iNode));
   }
   
-  su2double ratio = su2double(Global_nPointFine)/su2double(Global_nPointCoarse);
+  for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++) {
+    Key.push_back(fine_grid->GetnVertex(iMarker));
+    for (iVertex = 0; iVertex < fine_grid->GetnVertex(iMarker); iVertex++)
+      Key.push_back(fine_grid->vertex[iMarker][iVertex]->GetNode());
+  }
   
-  if (((nDim == 2) && (ratio < 2.5)) ||
-      ((nDim == 3) && (ratio < 2.5))) {
-    config->SetMGLevels(iMesh-1);
+  for (iPoint = 0; iPoint < Key.size(); iPoint++) {
+    Signature ^= Key[iPoint];
+    Signature *= 1099511628211UL;
   }
-  else {
-    if (rank == MASTER_NODE) {
-      if (iMesh == 1) cout <<"MG level: "<< iMesh-1 <<" -> CVs: " << Global_nPointFine << ". Agglomeration rate 1/1.00. CFL "<< config->GetCFL(iMesh-1) <<"." << endl;
-      cout <<"MG level: "<< iMesh <<" -> CVs: " << Global_nPointCoarse << ". Agglomeration rate 1/" << ratio <<". CFL "<< CFL <<"." << endl;
+  
+  return Signature;
+  
+}
+
+bool CMultiGridGeometry::ReadAgglomeration_Cache(CGeometry *fine_grid, CConfig *config, unsigned short iMesh) {
+  
+  unsigned long iPoint, iCoarsePoint, iChildren, Signature, Cache_Signature = 0, Cache_nPointFine = 0,
+  Cache_nPoint = 0, Cache_nPointDomain = 0, Local_Valid = 0, Global_Valid = 0;
+  unsigned short nChildren;
+  char Header[8];
+  int rank = MASTER_NODE;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  vector<unsigned short> Cache_nChildren;
+  vector<unsigned long> Cache_Children;
+  vector<char> Cache_Domain, Cache_Indirect;
+  
+  string filename = GetAgglomeration_CacheFile(config, iMesh);
+  ifstream cache_file(filename.c_str(), ios::in | ios::binary);
+  
+  /*--- Read the whole file before using it, so that a stale or truncated
+   cache can be rejected on every rank before touching the grids ---*/
+  
+  if (cache_file.is_open()) {
+    
+    Signature = GetAgglomeration_Signature(fine_grid);
+    
+    cache_file.read(Header, sizeof(Header));
+    cache_file.read((char *)&Cache_Signature, sizeof(unsigned long));
+    cache_file.read((char *)&Cache_nPointFine, sizeof(unsigned long));
+    cache_file.read((char *)&Cache_nPoint, sizeof(unsigned long));
+    cache_file.read((char *)&Cache_nPointDomain, sizeof(unsigned long));
+    
+    if (cache_file.good() && (strncmp(Header, "SU2MGAG1", 8) == 0) &&
+        (Cache_Signature == Signature) && (Cache_nPointFine == fine_grid->GetnPoint()) &&
+        (Cache_nPoint <= fine_grid->GetnPoint()) && (Cache_nPointDomain <= Cache_nPoint)) {
+      
+      Local_Valid = 1;
+      
+      Cache_nChildren.resize(Cache_nPoint);
+      Cache_Domain.resize(Cache_nPoint);
+      Cache_Indirect.resize(Cache_nPoint);
+      
+      for (iCoarsePoint = 0; iCoarsePoint < Cache_nPoint && Local_Valid; iCoarsePoint++) {
+        cache_file.read((char *)&Cache_nChildren[iCoarsePoint], sizeof(unsigned short));
+        cache_file.read(&Cache_Domain[iCoarsePoint], sizeof(char));
+        cache_file.read(&Cache_Indirect[iCoarsePoint], sizeof(char));
+        for (iChildren = 0; iChildren < Cache_nChildren[iCoarsePoint]; iChildren++) {
+          cache_file.read((char *)&iPoint, sizeof(unsigned long));
+          if (iPoint >= fine_grid->GetnPoint()) Local_Valid = 0;
+          Cache_Children.push_back(iPoint);
+        }
+        if (!cache_file.good()) Local_Valid = 0;
+      }
+      
     }
+    
+    cache_file.close();
+    
   }
- 
-  delete [] copy_marker;
+  
+  /*--- The halo agglomeration requires the same path on every rank ---*/
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&Local_Valid, &Global_Valid, 1, MPI_UNSIGNED_LONG, MPI_MIN, MPI_COMM_WORLD);
+#else
+  Global_Valid = Local_Valid;
+#endif
+  
+  if (Global_Valid == 0) return false;
+  
+  /*--- Rebuild the parent/children structure ---*/
+  
+  iChildren = 0;
+  for (iCoarsePoint = 0; iCoarsePoint < Cache_nPoint; iCoarsePoint++) {
+    for (nChildren = 0; nChildren < Cache_nChildren[iCoarsePoint]; nChildren++) {
+      iPoint = Cache_Children[iChildren]; iChildren++;
+      fine_grid->node[iPoint]->SetParent_CV(iCoarsePoint);
+      node[iCoarsePoint]->SetChildren_CV(nChildren, iPoint);
+    }
+    node[iCoarsePoint]->SetnChildren_CV(Cache_nChildren[iCoarsePoint]);
+    node[iCoarsePoint]->SetDomain(Cache_Domain[iCoarsePoint] != 0);
+    node[iCoarsePoint]->SetAgglomerate_Indirect(Cache_Indirect[iCoarsePoint] != 0);
+  }
+  
+  nPointDomain = Cache_nPointDomain;
+  nPoint = Cache_nPoint;
+  
+  if (rank == MASTER_NODE)
+    cout << "Reading the agglomeration of MG level " << iMesh << " from " << filename << "." << endl;
+  
+  return true;
   
 }
 
-
-CMultiGridGeometry::~CMultiGridGeometry(void) {
+void CMultiGridGeometry::WriteAgglomeration_Cache(CGeometry *fine_grid, CConfig *config, unsigned short iMesh) {
+  
+  unsigned long iPoint, iCoarsePoint, Signature, nPointFine;
+  unsigned short iChildren, nChildren;
+  char Domain, Indirect;
+  
+  string filename = GetAgglomeration_CacheFile(config, iMesh);
+  ofstream cache_file(filename.c_str(), ios::out | ios::binary);
+  
+  if (!cache_file.is_open()) {
+    cout << "There is no write permission for the agglomeration cache file " << filename << "." << endl;
+    return;
+  }
+  
+  Signature = GetAgglomeration_Signature(fine_grid);
+  nPointFine = fine_grid->GetnPoint();
+  
+  cache_file.write("SU2MGAG1", 8);
+  cache_file.write((char *)&Signature, sizeof(unsigned long));
+  cache_file.write((char *)&nPointFine, sizeof(unsigned long));
+  cache_file.write((char *)&nPoint, sizeof(unsigned long));
+  cache_file.write((char *)&nPointDomain, sizeof(unsigned long));
+  
+  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++) {
+    nChildren = node[iCoarsePoint]->GetnChildren_CV();
+    Domain = node[iCoarsePoint]->GetDomain();
+    Indirect = node[iCoarsePoint]->GetAgglomerate_Indirect();
+    cache_file.write((char *)&nChildren, sizeof(unsigned short));
+    cache_file.write(&Domain, sizeof(char));
+    cache_file.write(&Indirect, sizeof(char));
+    for (iChildren = 0; iChildren < nChildren; iChildren++) {
+      iPoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+      cache_file.write((char *)&iPoint, sizeof(unsigned long));
+    }
+  }
+  
+  cache_file.close();
   
 }
 
+
 bool CMultiGridGeometry::SetBoundAgglomeration(unsigned long CVPoint, short marker_seed, CGeometry *fine_grid, CConfig *config) {
   
   bool agglomerate_CV = false;
@@ -14491,12 +15718,11 @@ bool CMultiGridGeometry::GeometricalCheck(unsigned long iPoint, CGeometry *fine_
 void CMultiGridGeometry::SetSuitableNeighbors(vector<unsigned long> *Suitable_Indirect_Neighbors, unsigned long iPoint,
                                               unsigned long Index_CoarseCV, CGeometry *fine_grid) {
   
-  unsigned long jPoint, kPoint, lPoint;
-  unsigned short iNode, jNode, iNeighbor, jNeighbor, kNode;
-  bool SecondNeighborSeed, ThirdNeighborSeed;
+  unsigned long jPoint, kPoint, lPoint, iNeighbor, jNeighbor;
+  unsigned short iNode, jNode, kNode;
   vector<unsigned long>::iterator it;
   
-  /*--- Create a list with the first neighbors, including the seed ---*/
+  /*--- Create a sorted list with the first neighbors, including the seed ---*/
   
   vector<unsigned long> First_Neighbor_Points;
   First_Neighbor_Points.push_back(iPoint);
@@ -14505,9 +15731,14 @@ void CMultiGridGeometry::SetSuitableNeighbors(vector<unsigned long> *Suitable_In
     First_Neighbor_Points.push_back(jPoint);
   }
   
-  /*--- Create a list with the second neighbors, without first, and seed neighbors ---*/
+  sort(First_Neighbor_Points.begin(), First_Neighbor_Points.end());
+  it = unique(First_Neighbor_Points.begin(), First_Neighbor_Points.end());
+  First_Neighbor_Points.resize(it - First_Neighbor_Points.begin());
+  
+  /*--- Create a list with the second neighbors (and their origin), without first, and seed neighbors ---*/
   
-  vector<unsigned long> Second_Neighbor_Points, Second_Origin_Points, Suitable_Second_Neighbors;
+  vector<pair<unsigned long, unsigned long> > Second_Neighbor_Points, Third_Neighbor_Points;
+  vector<unsigned long> Suitable_Second_Neighbors;
   
   for (iNode = 0; iNode <	fine_grid->node[iPoint]->GetnPoint(); iNode ++) {
     jPoint = fine_grid->node[iPoint]->GetPoint(iNode);
@@ -14517,104 +15748,55 @@ void CMultiGridGeometry::SetSuitableNeighbors(vector<unsigned long> *Suitable_In
       
       /*--- Check that the second neighbor do not belong to the first neighbor or the seed ---*/
       
-      SecondNeighborSeed = true;
-      for (iNeighbor = 0; iNeighbor <	First_Neighbor_Points.size(); iNeighbor ++)
-        if (kPoint == First_Neighbor_Points[iNeighbor]) {
-          SecondNeighborSeed = false; break;
-        }
-      
-      if (SecondNeighborSeed) {
-        Second_Neighbor_Points.push_back(kPoint);
-        Second_Origin_Points.push_back(jPoint);
-      }
+      if (!binary_search(First_Neighbor_Points.begin(), First_Neighbor_Points.end(), kPoint))
+        Second_Neighbor_Points.push_back(make_pair(kPoint, jPoint));
       
     }
   }
   
-  /*---  Identify those second neighbors that are repeated (candidate to be added) ---*/
-  
-  for (iNeighbor = 0; iNeighbor <	Second_Neighbor_Points.size(); iNeighbor ++)
-    
-    for (jNeighbor = 0; jNeighbor <	Second_Neighbor_Points.size(); jNeighbor ++)
-      
-    /*--- Repeated second neighbor with different origin ---*/
-      
-      if ((Second_Neighbor_Points[iNeighbor] == Second_Neighbor_Points[jNeighbor]) &&
-          (Second_Origin_Points[iNeighbor] != Second_Origin_Points[jNeighbor]) &&
-          (iNeighbor < jNeighbor)) {
-        
-        Suitable_Indirect_Neighbors->push_back(Second_Neighbor_Points[iNeighbor]);
-        
-        /*--- Create alist with the suitable second neighbor, that we will use
-         to compute the third neighbors --*/
-        
-        Suitable_Second_Neighbors.push_back(Second_Neighbor_Points[iNeighbor]);
-        
-      }
-  
-  
-  /*--- Remove repeated from the suitable second neighbors ---*/
+  /*---  Identify those second neighbors that are repeated with a different origin
+   (candidate to be added), after sorting the repeated ones are contiguous ---*/
   
-  sort(Suitable_Second_Neighbors.begin(), Suitable_Second_Neighbors.end());
-  it = unique(Suitable_Second_Neighbors.begin(), Suitable_Second_Neighbors.end());
-  Suitable_Second_Neighbors.resize(it - Suitable_Second_Neighbors.begin());
+  sort(Second_Neighbor_Points.begin(), Second_Neighbor_Points.end());
   
-  /*--- Remove repeated from first neighbors ---*/
+  for (iNeighbor = 0; iNeighbor < Second_Neighbor_Points.size(); iNeighbor = jNeighbor) {
+    for (jNeighbor = iNeighbor+1; jNeighbor < Second_Neighbor_Points.size(); jNeighbor ++)
+      if (Second_Neighbor_Points[jNeighbor].first != Second_Neighbor_Points[iNeighbor].first) break;
+    if (Second_Neighbor_Points[jNeighbor-1].second != Second_Neighbor_Points[iNeighbor].second)
+      Suitable_Second_Neighbors.push_back(Second_Neighbor_Points[iNeighbor].first);
+  }
   
-  sort(First_Neighbor_Points.begin(), First_Neighbor_Points.end());
-  it = unique(First_Neighbor_Points.begin(), First_Neighbor_Points.end());
-  First_Neighbor_Points.resize(it - First_Neighbor_Points.begin());
+  Suitable_Indirect_Neighbors->insert(Suitable_Indirect_Neighbors->end(),
+                                      Suitable_Second_Neighbors.begin(), Suitable_Second_Neighbors.end());
   
   /*--- Create a list with the third neighbors, without first, second, and seed neighbors ---*/
   
-  vector<unsigned long> Third_Neighbor_Points, Third_Origin_Points;
-  
   for (jNode = 0; jNode <	Suitable_Second_Neighbors.size(); jNode ++) {
     kPoint = Suitable_Second_Neighbors[jNode];
     
     for (kNode = 0; kNode <	fine_grid->node[kPoint]->GetnPoint(); kNode ++) {
       lPoint = fine_grid->node[kPoint]->GetPoint(kNode);
       
-      /*--- Check that the third neighbor do not belong to the first neighbors or the seed ---*/
-      
-      ThirdNeighborSeed = true;
-      
-      for (iNeighbor = 0; iNeighbor <	First_Neighbor_Points.size(); iNeighbor ++)
-        if (lPoint == First_Neighbor_Points[iNeighbor]) {
-          ThirdNeighborSeed = false;
-          break;
-        }
-      
-      /*--- Check that the third neighbor do not belong to the second neighbors ---*/
+      /*--- Check that the third neighbor do not belong to the first neighbors,
+       the seed or the second neighbors (both lists are sorted) ---*/
       
-      for (iNeighbor = 0; iNeighbor <	Suitable_Second_Neighbors.size(); iNeighbor ++)
-        if (lPoint == Suitable_Second_Neighbors[iNeighbor]) {
-          ThirdNeighborSeed = false;
-          break;
-        }
-      
-      if (ThirdNeighborSeed) {
-        Third_Neighbor_Points.push_back(lPoint);
-        Third_Origin_Points.push_back(kPoint);
-      }
+      if (!binary_search(First_Neighbor_Points.begin(), First_Neighbor_Points.end(), lPoint) &&
+          !binary_search(Suitable_Second_Neighbors.begin(), Suitable_Second_Neighbors.end(), lPoint))
+        Third_Neighbor_Points.push_back(make_pair(lPoint, kPoint));
       
     }
   }
   
-  /*---  Identify those third neighbors that are repeated (candidate to be added) ---*/
+  /*---  Identify those third neighbors that are repeated with a different origin (candidate to be added) ---*/
   
-  for (iNeighbor = 0; iNeighbor <	Third_Neighbor_Points.size(); iNeighbor ++)
-    for (jNeighbor = 0; jNeighbor <	Third_Neighbor_Points.size(); jNeighbor ++)
-      
-    /*--- Repeated second neighbor with different origin ---*/
-      
-      if ((Third_Neighbor_Points[iNeighbor] == Third_Neighbor_Points[jNeighbor]) &&
-          (Third_Origin_Points[iNeighbor] != Third_Origin_Points[jNeighbor]) &&
-          (iNeighbor < jNeighbor)) {
-        
-        Suitable_Indirect_Neighbors->push_back(Third_Neighbor_Points[iNeighbor]);
-        
-      }
+  sort(Third_Neighbor_Points.begin(), Third_Neighbor_Points.end());
+  
+  for (iNeighbor = 0; iNeighbor < Third_Neighbor_Points.size(); iNeighbor = jNeighbor) {
+    for (jNeighbor = iNeighbor+1; jNeighbor < Third_Neighbor_Points.size(); jNeighbor ++)
+      if (Third_Neighbor_Points[jNeighbor].first != Third_Neighbor_Points[iNeighbor].first) break;
+    if (Third_Neighbor_Points[jNeighbor-1].second != Third_Neighbor_Points[iNeighbor].second)
+      Suitable_Indirect_Neighbors->push_back(Third_Neighbor_Points[iNeighbor].first);
+  }
   
   /*--- Remove repeated from Suitable Indirect Neighbors List ---*/
   
@@ -15833,14 +17015,23 @@ CMultiGridQueue::CMultiGridQueue(unsigned long val_npoint) {
   nPoint = val_npoint;
   Priority = new short[nPoint];
   RightCV = new bool[nPoint];
+  NextQueueCV = new long[nPoint];
+  PrevQueueCV = new long[nPoint];
+  
+  /*--- The buckets are stored as flat doubly linked lists, so that a CV
+   can be added, removed or moved between priorities in constant time ---*/
   
-  QueueCV.resize(1);
+  QueueHead.assign(1, -1);
+  QueueTail.assign(1, -1);
+  MaxPriority = 0;
+  nQueueCV = 0;
+  nRightCV_Zero = 0;
   
   /*--- Queue initialization with all the points in the finer grid ---*/
   for (iPoint = 0; iPoint < nPoint; iPoint ++) {
-    QueueCV[0].push_back(iPoint);
-    Priority[iPoint] = 0;
+    Priority[iPoint] = -1;
     RightCV[iPoint] = true;
+    AddCV(iPoint, 0);
   }
   
 }
@@ -15849,13 +17040,13 @@ CMultiGridQueue::~CMultiGridQueue(void) {
   
   delete[] Priority;
   delete[] RightCV;
+  delete[] NextQueueCV;
+  delete[] PrevQueueCV;
   
 }
 
 void CMultiGridQueue::AddCV(unsigned long val_new_point, unsigned short val_number_neighbors) {
   
-  unsigned short Max_Neighbors = QueueCV.size()-1;
-  
   /*--- Basic check ---*/
   if (val_new_point > nPoint) {
     cout << "The index of the CV is greater than the size of the priority list." << endl;
@@ -15863,24 +17054,29 @@ void CMultiGridQueue::AddCV(unsigned long val_new_point, unsigned short val_numb
   }
   
   /*--- Resize the list ---*/
-  if (val_number_neighbors > Max_Neighbors)
-    QueueCV.resize(val_number_neighbors+1);
+  if (val_number_neighbors >= QueueHead.size()) {
+    QueueHead.resize(val_number_neighbors+1, -1);
+    QueueTail.resize(val_number_neighbors+1, -1);
+  }
   
   /*--- Find the point in the queue ---*/
-  bool InQueue = false;
-  if (Priority[val_new_point] == val_number_neighbors) InQueue = true;
+  if (Priority[val_new_point] == val_number_neighbors) return;
   
-  if (!InQueue) {
-    /*--- Add the control volume, and update the priority list ---*/
-    QueueCV[val_number_neighbors].push_back(val_new_point);
-    Priority[val_new_point] = val_number_neighbors;
-  }
+  /*--- Add the control volume at the end of the bucket, and update the priority list ---*/
+  NextQueueCV[val_new_point] = -1;
+  PrevQueueCV[val_new_point] = QueueTail[val_number_neighbors];
+  if (QueueTail[val_number_neighbors] != -1) NextQueueCV[QueueTail[val_number_neighbors]] = val_new_point;
+  else QueueHead[val_number_neighbors] = val_new_point;
+  QueueTail[val_number_neighbors] = val_new_point;
+  
+  Priority[val_new_point] = val_number_neighbors;
+  if (val_number_neighbors > MaxPriority) MaxPriority = val_number_neighbors;
+  if ((val_number_neighbors == 0) && RightCV[val_new_point]) nRightCV_Zero++;
+  nQueueCV++;
   
 }
 
 void CMultiGridQueue::RemoveCV(unsigned long val_remove_point) {
-  unsigned short iPoint;
-  bool check;
   
   /*--- Basic check ---*/
   if (val_remove_point > nPoint) {
@@ -15895,29 +17091,26 @@ void CMultiGridQueue::RemoveCV(unsigned long val_remove_point) {
     exit(EXIT_FAILURE);
   }
   
-  /*--- Find the point in the queue ---*/
-  vector<unsigned long>::iterator ItQueue = find(QueueCV[Number_Neighbors].begin(),
-                                                 QueueCV[Number_Neighbors].end(),
-                                                 val_remove_point);
-  if ( ItQueue != QueueCV[Number_Neighbors].end() ) QueueCV[Number_Neighbors].erase(ItQueue);
+  /*--- Unlink the point from its bucket ---*/
+  long Prev = PrevQueueCV[val_remove_point], Next = NextQueueCV[val_remove_point];
+  if (Prev != -1) NextQueueCV[Prev] = Next; else QueueHead[Number_Neighbors] = Next;
+  if (Next != -1) PrevQueueCV[Next] = Prev; else QueueTail[Number_Neighbors] = Prev;
   
   Priority[val_remove_point] = -1;
+  if ((Number_Neighbors == 0) && RightCV[val_remove_point]) nRightCV_Zero--;
+  nQueueCV--;
   
-  /*--- Check that the size of the queue is the right one ---*/
-  unsigned short Size_QueueCV = 0;
-  check = false;
-  for (iPoint = 0; iPoint < QueueCV.size(); iPoint ++)
-    if (QueueCV[iPoint].size() != 0) { Size_QueueCV = iPoint; check = true;}
-  
-  /*--- Resize the queue, if check = false, the queue is empty, at least
-   we need one element in the queue ---*/
-  if (check) QueueCV.resize(Size_QueueCV+1);
-  else QueueCV.resize(1);
+  /*--- Update the highest non-empty priority, the lowest priority
+   is always kept even if it is empty ---*/
+  while ((MaxPriority > 0) && (QueueHead[MaxPriority] == -1)) MaxPriority--;
   
 }
 
 void CMultiGridQueue::MoveCV(unsigned long val_move_point, short val_number_neighbors) {
   
+  /*--- Remove the control volume ---*/
+  RemoveCV(val_move_point);
+  
   if (val_number_neighbors < 0) {
     val_number_neighbors = 0;
     RightCV[val_move_point] = false;
@@ -15926,9 +17119,6 @@ void CMultiGridQueue::MoveCV(unsigned long val_move_point, short val_number_neig
     RightCV[val_move_point] = true;
   }
   
-  /*--- Remove the control volume ---*/
-  RemoveCV(val_move_point);
-  
   /*--- Add a new control volume ---*/
   AddCV(val_move_point, val_number_neighbors);
   
@@ -15973,14 +17163,14 @@ void CMultiGridQueue::RedPriorityCV(unsigned long val_red_point) {
 }
 
 void CMultiGridQueue::VisualizeQueue(void) {
-  unsigned short iPoint;
-  unsigned long jPoint;
+  unsigned short iPriority;
+  long jPoint;
   
   cout << endl;
-  for (iPoint = 0; iPoint < QueueCV.size(); iPoint ++) {
-    cout << "Number of neighbors " << iPoint <<": ";
-    for (jPoint = 0; jPoint < QueueCV[iPoint].size(); jPoint ++) {
-      cout << QueueCV[iPoint][jPoint] << " ";
+  for (iPriority = 0; iPriority <= MaxPriority; iPriority ++) {
+    cout << "Number of neighbors " << iPriority <<": ";
+    for (jPoint = QueueHead[iPriority]; jPoint != -1; jPoint = NextQueueCV[jPoint]) {
+      cout << jPoint << " ";
     }
     cout << endl;
   }
@@ -15996,39 +17186,21 @@ void CMultiGridQueue::VisualizePriority(void) {
 }
 
 long CMultiGridQueue::NextCV(void) {
-  if (QueueCV.size() != 0) return QueueCV[QueueCV.size()-1][0];
-  else return -1;
+  return QueueHead[MaxPriority];
 }
 
 bool CMultiGridQueue::EmptyQueue(void) {
-  unsigned short iPoint;
   
   /*--- In case there is only the no agglomerated elements,
    check if they can be agglomerated or we have already finished ---*/
-  bool check = true;
   
-  if ( QueueCV.size() == 1 ) {
-    for (iPoint = 0; iPoint < QueueCV[0].size(); iPoint ++) {
-      if (RightCV[QueueCV[0][iPoint]]) { check = false; break; }
-    }
-  }
-  else {
-    for (iPoint = 1; iPoint < QueueCV.size(); iPoint ++)
-      if (QueueCV[iPoint].size() != 0) { check = false; break;}
-  }
+  if (MaxPriority == 0) return (nRightCV_Zero == 0);
+  else return false;
   
-  return check;
 }
 
 unsigned long CMultiGridQueue::TotalCV(void) {
-  unsigned short iPoint;
-  unsigned long TotalCV;
-  
-  TotalCV = 0;
-  for (iPoint = 0; iPoint < QueueCV.size(); iPoint ++)
-    if (QueueCV[iPoint].size() != 0) { TotalCV += QueueCV[iPoint].size(); }
-  
-  return TotalCV;
+  return nQueueCV;
 }
 
 void CMultiGridQueue::Update(unsigned long iPoint, CGeometry *fine_grid) {
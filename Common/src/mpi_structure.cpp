@@ -35,6 +35,8 @@
 
 #ifdef HAVE_MPI
 
+double CMPIWrapper::CommTime = 0.0;
+
 #if defined COMPLEX_TYPE || defined ADOLC_FORWARD_TYPE || defined CODI_FORWARD_TYPE
 std::map<MPI_Request*, CAuxMPIWrapper::CommInfo>
 CAuxMPIWrapper::CommInfoMap;
@@ -236,6 +236,12 @@ public:
    */
   void StartSolver();
 
+  /*!
+   * \brief Get the wall clock time, used to measure the phases of the iterations.
+   * \return Wall clock time (s).
+   */
+  su2double GetWall_Time(void);
+
   /*!
    * \brief A virtual member.
    */
@@ -46,6 +46,7 @@
 #include <cmath>
 #include <time.h>
 #include <fstream>
+#include <pthread.h>
 
 #include "solver_structure.hpp"
 #include "integration_structure.hpp"
@@ -118,7 +119,10 @@ class COutput {
   su2double **Local_Data;
   su2double **Parallel_Data;              // node i (x, y, z) = (Coords[0][i], Coords[1][i], Coords[2][i])
   su2double **Parallel_Surf_Data;              // node i (x, y, z) = (Coords[0][i], Coords[1][i], Coords[2][i])
+  bool *Local_Filter;                     // Point iPoint of the partition passes the output filters
+  bool *Parallel_Filter;                  // Point i of the linear partition passes the output filters
   vector<string> Variable_Names;
+  vector<string> Field_Names;             // names of the solver-registered per-point fields in the merged data
   
   su2double **Data;
   unsigned short nVar_Consv, nVar_Total, nVar_Extra, nZones;
@@ -127,6 +131,27 @@ class COutput {
   su2double RhoRes_New, RhoRes_Old;
   int cgns_base, cgns_zone, cgns_base_results, cgns_zone_results;
   su2double Sum_Total_RadialDistortion, Sum_Total_CircumferentialDistortion; // Add all the distortion to compute a run average.
+  
+  unsigned long Output_ExtIter;   // External iteration of the merged solution (Data)
+  string Restart_Metadata;        // Flow conditions written at the end of the restart file
+  
+  pthread_t Output_Thread;        // Background thread writing the staged (merged) solution files
+  bool Output_Thread_Active;      // The background thread owns the merged data until it is joined
+  CConfig *Staged_Config;         // Zone definition, geometry and solution of the staged files
+  CGeometry *Staged_Geometry;
+  CSolver **Staged_Solver;
+  unsigned short Staged_iZone, Staged_nZone;
+  bool Staged_Vol, Staged_Srf, Staged_Async;
+  
+  map<string, map<unsigned long, string> > XDMF_Series;  // Grids of each XDMF time series (unsteady, harmonic balance), by step
+  
+  ofstream Stream_File;                   // History stream (schema line, then one record per iteration)
+  unsigned short Stream_Format;           // Format of the history stream, NO_STREAM until the file is opened
+  unsigned long Stream_Batch;             // Number of records buffered before they are written
+  vector<string> Stream_Fields;           // Schema of the records, fixed by the first record
+  vector<passivedouble> Stream_Record;    // Values of the record being assembled
+  vector<passivedouble> Stream_Buffer;    // Records not yet written to the file
+  su2double Phase_Time[4];                // Wall time of the phases of the last iteration (preprocessing, solver, output, communications)
 
   
 protected:
@@ -167,6 +192,43 @@ public:
   void SetBaselineResult_Files(CSolver **solver, CGeometry **geometry, CConfig **config,
                                unsigned long iExtIter, unsigned short val_nZone);
   
+  /*!
+   * \brief Stage the merged solution of a zone for writing (restart, volume and surface files). Everything
+   *        the writers need from the (changing) problem definition is copied here.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Container vector with all the solutions.
+   * \param[in] val_iZone - iZone index.
+   * \param[in] val_nZone - Total number of domains in the grid file.
+   * \param[in] Wrt_Vol - Write a volume solution file.
+   * \param[in] Wrt_Srf - Write a surface solution file.
+   * \param[in] val_async - Write the staged files from a background thread.
+   */
+  void StageResult_Files(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone,
+                         unsigned short val_nZone, bool Wrt_Vol, bool Wrt_Srf, bool val_async);
+  
+  /*!
+   * \brief Write the staged restart, volume and surface files (master node, merged data).
+   */
+  void WriteStaged_Files(void);
+  
+  /*!
+   * \brief Release the merged data of the staged files.
+   */
+  void DeallocateStaged_Files(void);
+  
+  /*!
+   * \brief Wait for the background thread (if any) to finish writing the staged files, then release
+   *        the merged data. Must be called before merging a new solution.
+   */
+  void WaitResult_Files(void);
+  
+  /*!
+   * \brief Entry point of the background output thread.
+   * \param[in] output - Output object with the staged files.
+   */
+  static void *Output_Thread_Routine(void *output);
+  
   /*!
    * \brief Writes and organizes the all the output files, except the history one, for serial computations.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -329,6 +391,16 @@ public:
    * \param[in] val_iZone - iZone index.
    */
   void SetRestart_Parallel(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone);
+
+  /*!
+   * \brief Write a native SU2 restart file (binary) in parallel. The header holds the
+   *        number of variables and points and the variable names, followed by one
+   *        fixed-width record per point sorted by global index, and the restart metadata.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_iZone - iZone index.
+   */
+  void SetRestart_Parallel_Binary(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone);
   
   /*!
    * \brief Write the x, y, & z coordinates to a CGNS output file.
@@ -372,6 +444,29 @@ public:
    */
   void SetParaview_MeshASCII(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol, bool new_file);
 
+  /*!
+   * \brief Write the sorted solution data and connectivity to a Paraview binary (XML) file in parallel.
+   *        Each rank writes its own .vtu piece (raw appended data) and the master writes the .pvtu index.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_iZone - Current zone.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] surf_sol - Flag controlling whether this is a volume or surface file.
+   */
+  void SetParaview_Binary_Parallel(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol);
+  
+  /*!
+   * \brief Write the sorted solution data and connectivity to an XDMF file in parallel. All ranks write
+   *        their points, elements and variables to a single raw binary file with collective MPI-IO,
+   *        and the master writes the .xmf description (and the time series of unsteady or HB runs).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_iZone - Current zone.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] surf_sol - Flag controlling whether this is a volume or surface file.
+   */
+  void SetXDMF_Parallel(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol);
+
   /*!
    * \brief Write a Tecplot ASCII solution file.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -422,10 +517,9 @@ public:
   void SetSU2_MeshASCII(CConfig *config, CGeometry *geometry);
   
   /*!
-   * \brief Write the nodal coordinates and connectivity to a Tecplot binary mesh file.
+   * \brief Write the nodal coordinates, connectivity and markers to a SU2 binary mesh file.
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
-   * \param[in] val_iZone - iZone index.
    */
   void SetSU2_MeshBinary(CConfig *config, CGeometry *geometry);
 
@@ -521,6 +615,32 @@ public:
    * \param[in] config - Definition of the particular problem.
    */
   void SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config);
+  
+  /*!
+   * \brief Add a value to the record of the history stream being assembled.
+   * \param[in] val_name - Name of the field (only used by the first record, which fixes the schema).
+   * \param[in] val_value - Value of the field.
+   */
+  void AddHistoryStream_Value(const char *val_name, su2double val_value);
+  
+  /*!
+   * \brief Append the assembled record to the history stream, opening the file on the first record
+   *        and writing the buffered records every HISTORY_STREAM_BATCH records.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetHistoryStream_Record(CConfig *config);
+  
+  /*!
+   * \brief Write the buffered records of the history stream to the file.
+   */
+  void WriteHistoryStream(void);
+  
+  /*!
+   * \brief Store the wall time of a phase of the current iteration, for the history stream.
+   * \param[in] val_phase - Phase (0: preprocessing, 1: solver, 2: output, 3: communications).
+   * \param[in] val_time - Wall time (s).
+   */
+  void SetPhase_Time(unsigned short val_phase, su2double val_time);
 
   /*! 
    * \brief Write the history file and the convergence on the screen for serial computations.
@@ -660,6 +780,20 @@ public:
    */
   void SortOutputData(CConfig *config, CGeometry *geometry);
   
+  /*!
+   * \brief Flag the grid nodes of the partition that pass the output filters (box, wall distance, markers, stride).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SetOutput_Filter(CConfig *config, CGeometry *geometry);
+  
+  /*!
+   * \brief Remove the filtered out points from the sorted volume data and renumber the volume connectivity.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void FilterOutputData(CConfig *config, CGeometry *geometry);
+  
   /*!
    * \brief Sort the surface output data for each grid node into a linear partitioning across all processors.
    * \param[in] config - Definition of the particular problem.
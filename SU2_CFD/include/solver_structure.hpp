@@ -115,6 +115,13 @@ protected:
 
   unsigned short nOutputVariables;  /*!< \brief Number of variables to write. */
 
+  passivedouble *Restart_Data;  /*!< \brief Auxiliary structure for holding the data values from a restart (nPointDomain x Restart_Vars). */
+  unsigned short Restart_Vars;  /*!< \brief Number of fields per point in the restart data (coordinates included, point index excluded). */
+
+  typedef su2double (CVariable::*OutputField_Getter)(void);  /*!< \brief Accessor (CVariable getter) of a per-point output field. */
+  vector<string> OutputField_Names;                 /*!< \brief Names of the per-point fields registered for output. */
+  vector<OutputField_Getter> OutputField_Getters;   /*!< \brief Accessors of the per-point fields registered for output. */
+
   //su2double **FimlFeatures; //JRH 02022018 - Array to store variables to be output for machine learning (features)
   //unsigned short numFeatures = 0; //JRH 02022018 - Number of features to be output at each node
   unsigned short kind_scale;
@@ -147,6 +154,14 @@ protected:
   su2double **deltas;
   bool jrh_debug;
 
+  /*!
+   * \brief Register a per-point field (read through a CVariable getter) to be written in the
+   *        restart and visualization files, after the variables of the solver.
+   * \param[in] val_name - Name of the field in the output files.
+   * \param[in] val_getter - Getter of the field in CVariable.
+   */
+  void RegisterOutputField(string val_name, OutputField_Getter val_getter);
+
 public:
 
   CSysVector LinSysSol;    /*!< \brief vector to store iterative solution of implicit linear system. */
@@ -364,6 +379,24 @@ public:
    */
   unsigned short GetnOutputVariables(void);
   
+  /*!
+   * \brief Get the number of per-point fields registered for output.
+   */
+  unsigned short GetnOutputFields(void);
+  
+  /*!
+   * \brief Get the name of a registered output field.
+   * \param[in] val_field - Index of the field.
+   */
+  string GetOutputField_Name(unsigned short val_field);
+  
+  /*!
+   * \brief Get the value of a registered output field.
+   * \param[in] val_field - Index of the field.
+   * \param[in] val_point - Index of the point.
+   */
+  su2double GetOutputField(unsigned short val_field, unsigned long val_point);
+  
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -3449,6 +3482,43 @@ public:
   virtual void LoadRestart_FSI(CGeometry *geometry, CSolver ***solver,
                                CConfig *config, int val_iter);
   
+  /*!
+   * \brief Read the fields of a SU2 native restart file that belong to the domain points
+   *        of this rank into Restart_Data (ASCII or binary, following READ_BINARY_RESTART).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file.
+   */
+  void Read_SU2_Restart(CGeometry *geometry, CConfig *config, string val_filename);
+  
+  /*!
+   * \brief Read a SU2 native ASCII restart file into Restart_Data.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file.
+   */
+  void Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, string val_filename);
+  
+  /*!
+   * \brief Read a SU2 native binary restart file into Restart_Data (collective MPI-IO read).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file.
+   */
+  void Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename);
+  
+  /*!
+   * \brief Get the metadata (AOA=, EXT_ITER=, ...) stored after the records of a binary restart file.
+   * \param[in] val_filename - Name of the restart file.
+   * \return Metadata lines, in the same format as the trailer of the ASCII restart file.
+   */
+  string Read_SU2_Restart_Metadata(string val_filename);
+  
+  /*!
+   * \brief Release the data read from a restart file.
+   */
+  void Delete_Restart_Data(void);
+  
   /*!
    * \brief Gauss method for solving a linear system.
    * \param[in] A - Matrix Ax = b.
@@ -940,6 +940,17 @@ inline unsigned short CSolver::GetnVar(void) { return nVar; }
 
 inline unsigned short CSolver::GetnOutputVariables(void) { return nOutputVariables; }
 
+inline void CSolver::RegisterOutputField(string val_name, OutputField_Getter val_getter) {
+  OutputField_Names.push_back(val_name);
+  OutputField_Getters.push_back(val_getter);
+}
+
+inline unsigned short CSolver::GetnOutputFields(void) { return OutputField_Names.size(); }
+
+inline string CSolver::GetOutputField_Name(unsigned short val_field) { return OutputField_Names[val_field]; }
+
+inline su2double CSolver::GetOutputField(unsigned short val_field, unsigned long val_point) { return (node[val_point]->*OutputField_Getters[val_field])(); }
+
 inline unsigned short CSolver::GetnPrimVar(void) { return nPrimVar; }
 
 inline unsigned short CSolver::GetnPrimVarGrad(void) { return nPrimVarGrad; }
@@ -392,6 +392,10 @@ void CDriver::Postprocessing() {
   MPI_Comm_size(MPI_COMM_WORLD, &size);
 #endif
 
+  /*--- Finish writing the last solution files (asynchronous output). ---*/
+
+  if (output != NULL) output->WaitResult_Files();
+
     /*--- Output some information to the console. ---*/
 
   if (rank == MASTER_NODE) {
@@ -556,10 +560,22 @@ void CDriver::Geometrical_Preprocessing() {
     if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
     geometry_container[iZone][MESH_0]->SetPoint_Connectivity();
 
-    /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+    /*--- Renumbering points for cache locality (halo points are kept at the end) ---*/
 
-    if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-    geometry_container[iZone][MESH_0]->SetRCM_Ordering(config_container[iZone]);
+    switch (config_container[iZone]->GetKind_Point_Ordering()) {
+      case RCM_POINT_ORDERING:
+        if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
+        geometry_container[iZone][MESH_0]->SetRCM_Ordering(config_container[iZone]);
+        break;
+      case HILBERT_POINT_ORDERING:
+        if (rank == MASTER_NODE) cout << "Renumbering points (Hilbert Curve Ordering)." << endl;
+        geometry_container[iZone][MESH_0]->SetSFC_Ordering(config_container[iZone]);
+        break;
+      case MORTON_POINT_ORDERING:
+        if (rank == MASTER_NODE) cout << "Renumbering points (Morton Curve Ordering)." << endl;
+        geometry_container[iZone][MESH_0]->SetSFC_Ordering(config_container[iZone]);
+        break;
+    }
 
     /*--- recompute elements surrounding points, points surrounding points ---*/
 
@@ -582,6 +598,10 @@ void CDriver::Geometrical_Preprocessing() {
 
     if (rank == MASTER_NODE) cout << "Identifying edges and vertices." << endl;
     geometry_container[iZone][MESH_0]->SetEdges();
+    geometry_container[iZone][MESH_0]->SetEdge_Ordering(config_container[iZone]);
+    geometry_container[iZone][MESH_0]->SetEdge_Coloring(config_container[iZone]);
+    if ((rank == MASTER_NODE) && (geometry_container[iZone][MESH_0]->GetnEdgeColor() > 1))
+      cout << "Edges grouped in " << geometry_container[iZone][MESH_0]->GetnEdgeColor() << " colors." << endl;
     geometry_container[iZone][MESH_0]->SetVertex(config_container[iZone]);
 
     /*--- Compute cell center of gravity ---*/
@@ -640,6 +660,8 @@ void CDriver::Geometrical_Preprocessing() {
       /*--- Create the edge structure ---*/
 
       geometry_container[iZone][iMGlevel]->SetEdges();
+      geometry_container[iZone][iMGlevel]->SetEdge_Ordering(config_container[iZone]);
+      geometry_container[iZone][iMGlevel]->SetEdge_Coloring(config_container[iZone]);
       geometry_container[iZone][iMGlevel]->SetVertex(geometry_container[iZone][iMGlevel-1], config_container[iZone]);
 
       /*--- Create the control volume structures ---*/
@@ -2460,8 +2482,27 @@ void CDriver::StartSolver() {
     historyFile_FSI.close();
   }
 
+  /*--- Timers for the measured work of each rank (partition weights) ---*/
+
+#ifndef HAVE_MPI
+  su2double LoopStartTime = su2double(clock())/su2double(CLOCKS_PER_SEC), LoopCommTime = 0.0;
+#else
+  su2double LoopStartTime = MPI_Wtime(), LoopCommTime = SU2_MPI::GetCommTime();
+#endif
+
+  /*--- Wall time of the phases of each iteration (history stream). The output
+   of an iteration happens after its monitoring, so the output time reported
+   with an iteration is the one of the previous iteration. ---*/
+
+  su2double PhaseTime[3], PhaseCommTime = 0.0;
+
   while ( ExtIter < config_container[ZONE_0]->GetnExtIter() ) {
 
+#ifdef HAVE_MPI
+    PhaseCommTime = SU2_MPI::GetCommTime();
+#endif
+    PhaseTime[0] = GetWall_Time();
+
     /*--- Perform some external iteration preprocessing. ---*/
 
     PreprocessExtIter(ExtIter);
@@ -2474,6 +2515,8 @@ void CDriver::StartSolver() {
 
       DynamicMeshUpdate(ExtIter);
 
+      PhaseTime[1] = GetWall_Time();
+
       /*--- Run a single iteration of the problem (mean flow, wave, heat, ...). ---*/
 
       Run();
@@ -2484,16 +2527,26 @@ void CDriver::StartSolver() {
 
     }
     else {
+      PhaseTime[1] = GetWall_Time();
       Run();      // In the FSIDriver case, mesh and solution updates are already included into the Run function
     }
 
+    PhaseTime[2] = GetWall_Time();
+    output->SetPhase_Time(0, PhaseTime[1]-PhaseTime[0]);
+    output->SetPhase_Time(1, PhaseTime[2]-PhaseTime[1]);
+#ifdef HAVE_MPI
+    output->SetPhase_Time(3, SU2_MPI::GetCommTime()-PhaseCommTime);
+#endif
+
     /*--- Monitor the computations after each iteration. ---*/
 
     Monitor(ExtIter);
 
     /*--- Output the solution in files. ---*/
 
+    PhaseTime[0] = GetWall_Time();
     Output(ExtIter);
+    output->SetPhase_Time(2, GetWall_Time()-PhaseTime[0]);
 
     /*--- If the convergence criteria has been met, terminate the simulation. ---*/
 
@@ -2503,6 +2556,30 @@ void CDriver::StartSolver() {
 
   }
 
+  /*--- Write the measured work per point for the weighted partitioning of
+   the next run: wall time of the iterations, minus the time this rank spent
+   blocked in communications (i.e. waiting for the other ranks). ---*/
+
+  if (config_container[ZONE_0]->GetWrt_Partition_Weights()) {
+#ifndef HAVE_MPI
+    su2double LoopTime = su2double(clock())/su2double(CLOCKS_PER_SEC) - LoopStartTime;
+#else
+    su2double LoopTime = MPI_Wtime() - LoopStartTime - (SU2_MPI::GetCommTime() - LoopCommTime);
+#endif
+    unsigned long nPointDomain = max(geometry_container[ZONE_0][MESH_0]->GetnPointDomain(), (unsigned long)1);
+    geometry_container[ZONE_0][MESH_0]->SetPartition_WeightsFile(config_container[ZONE_0], LoopTime/su2double(nPointDomain));
+  }
+
+}
+
+su2double CDriver::GetWall_Time(void) {
+
+#ifndef HAVE_MPI
+  return su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  return MPI_Wtime();
+#endif
+
 }
 
 void CDriver::PreprocessExtIter(unsigned long ExtIter) {
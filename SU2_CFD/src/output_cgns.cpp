@@ -513,3 +513,294 @@ void COutput::SetCGNS_Solution(CConfig *config, CGeometry *geometry, unsigned sh
 #endif
   
 }
+
+void COutput::SetXDMF_Parallel(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol) {
+  
+  unsigned short iVar, iDim, iType, nType, nDim = geometry->GetnDim();
+  unsigned short Kind_Solver = config->GetKind_Solver();
+  
+  unsigned long iPoint, iElem, iConn, nLocal, nLocal_Elem = 0, nLocal_Conn = 0;
+  unsigned long nGlobal_Poin = 0, nGlobal_Elem = 0, nGlobal_Conn = 0, Point_Offset = 0, Conn_Offset = 0;
+  unsigned long iExtIter = config->GetExtIter(), Step = 0;
+  
+  bool adjoint = config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint();
+  bool harmonic_balance = (config->GetUnsteady_Simulation() == HARMONIC_BALANCE);
+  bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+                    (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
+  
+  passivedouble Time = 0.0;
+  
+  int iProcessor;
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  
+  char cstr[200], buffer[50];
+  string filename, series;
+  
+  /*--- Write file name without extension (same naming as the other
+   parallel writers). ---*/
+  
+  if (surf_sol) {
+    if (adjoint) filename = config->GetSurfAdjCoeff_FileName();
+    else filename = config->GetSurfFlowCoeff_FileName();
+  }
+  else {
+    if (adjoint) filename = config->GetAdj_FileName();
+    else filename = config->GetFlow_FileName();
+  }
+  
+  if (Kind_Solver == FEM_ELASTICITY) {
+    if (surf_sol) filename = config->GetSurfStructure_FileName().c_str();
+    else filename = config->GetStructure_FileName().c_str();
+  }
+  
+  if (Kind_Solver == WAVE_EQUATION) {
+    if (surf_sol) filename = config->GetSurfWave_FileName().c_str();
+    else filename = config->GetWave_FileName().c_str();
+  }
+  
+  if (Kind_Solver == HEAT_EQUATION) {
+    if (surf_sol) filename = config->GetSurfHeat_FileName().c_str();
+    else filename = config->GetHeat_FileName().c_str();
+  }
+  
+  if (Kind_Solver == POISSON_EQUATION) {
+    if (surf_sol) filename = config->GetSurfStructure_FileName().c_str();
+    else filename = config->GetStructure_FileName().c_str();
+  }
+  
+  if (config->GetKind_SU2() == SU2_DOT) {
+    if (surf_sol) filename = config->GetSurfSens_FileName();
+    else filename = config->GetVolSens_FileName();
+  }
+  
+  strcpy (cstr, filename.c_str());
+  
+  /*--- Special cases where a number needs to be appended to the file name.
+   The time instances of a harmonic balance run and the physical time steps
+   of an unsteady run are also collected in a time series file, named as the
+   solution file without the instance or iteration number. ---*/
+  
+  if ((Kind_Solver == EULER || Kind_Solver == NAVIER_STOKES || Kind_Solver == RANS ||
+       Kind_Solver == ADJ_EULER || Kind_Solver == ADJ_NAVIER_STOKES || Kind_Solver == ADJ_RANS ||
+       Kind_Solver == DISC_ADJ_EULER || Kind_Solver == DISC_ADJ_NAVIER_STOKES || Kind_Solver == DISC_ADJ_RANS) &&
+      (val_nZone > 1) ) {
+    if (harmonic_balance) {
+      series = string(cstr);
+      Step = val_iZone;
+      Time = SU2_TYPE::GetValue(config->GetHarmonicBalance_Period())*val_iZone/val_nZone;
+    }
+    SPRINTF (buffer, "_%d", SU2_TYPE::Int(val_iZone));
+    strcat(cstr, buffer);
+  }
+  
+  if (config->GetUnsteady_Simulation() && config->GetWrt_Unsteady() && !harmonic_balance) {
+    series = string(cstr);
+    Step = iExtIter;
+    if (dual_time) Time = SU2_TYPE::GetValue(config->GetDelta_UnstTime())*iExtIter;
+    else Time = iExtIter;
+    if (SU2_TYPE::Int(iExtIter) < 10) SPRINTF (buffer, "_0000%d", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 10) && (SU2_TYPE::Int(iExtIter) < 100)) SPRINTF (buffer, "_000%d", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 100) && (SU2_TYPE::Int(iExtIter) < 1000)) SPRINTF (buffer, "_00%d", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 1000) && (SU2_TYPE::Int(iExtIter) < 10000)) SPRINTF (buffer, "_0%d", SU2_TYPE::Int(iExtIter));
+    if (SU2_TYPE::Int(iExtIter) >= 10000) SPRINTF (buffer, "_%d", SU2_TYPE::Int(iExtIter));
+    strcat(cstr, buffer);
+  }
+  
+  filename = string(cstr);
+  
+  /*--- The heavy data is referenced from the .xmf files relative to their
+   own location. ---*/
+  
+  string basename = filename + ".bin";
+  if (basename.find_last_of("/\\") != string::npos)
+    basename = basename.substr(basename.find_last_of("/\\")+1);
+  
+  /*--- Select the sorted point data and connectivity for this file. The
+   connectivity holds 1-based global indices in the numbering of the data
+   (volume numbering, or the renumbered surface points). ---*/
+  
+  su2double **Data = (surf_sol ? Parallel_Surf_Data : Parallel_Data);
+  nLocal = (surf_sol ? nSurf_Poin_Par : nParallel_Poin);
+  
+  int *Conn_Type[6];
+  unsigned long nElem_Type[6];
+  unsigned short nNode_Type[6];
+  int64_t XDMF_Type[6];
+  
+  if (surf_sol) {
+    nType = 3;
+    Conn_Type[0] = Conn_Line_Par;      nElem_Type[0] = nParallel_Line;      nNode_Type[0] = N_POINTS_LINE;          XDMF_Type[0] = 2;
+    Conn_Type[1] = Conn_BoundTria_Par; nElem_Type[1] = nParallel_BoundTria; nNode_Type[1] = N_POINTS_TRIANGLE;      XDMF_Type[1] = 4;
+    Conn_Type[2] = Conn_BoundQuad_Par; nElem_Type[2] = nParallel_BoundQuad; nNode_Type[2] = N_POINTS_QUADRILATERAL; XDMF_Type[2] = 5;
+  } else {
+    nType = 6;
+    Conn_Type[0] = Conn_Tria_Par; nElem_Type[0] = nParallel_Tria; nNode_Type[0] = N_POINTS_TRIANGLE;      XDMF_Type[0] = 4;
+    Conn_Type[1] = Conn_Quad_Par; nElem_Type[1] = nParallel_Quad; nNode_Type[1] = N_POINTS_QUADRILATERAL; XDMF_Type[1] = 5;
+    Conn_Type[2] = Conn_Tetr_Par; nElem_Type[2] = nParallel_Tetr; nNode_Type[2] = N_POINTS_TETRAHEDRON;   XDMF_Type[2] = 6;
+    Conn_Type[3] = Conn_Hexa_Par; nElem_Type[3] = nParallel_Hexa; nNode_Type[3] = N_POINTS_HEXAHEDRON;    XDMF_Type[3] = 9;
+    Conn_Type[4] = Conn_Pris_Par; nElem_Type[4] = nParallel_Pris; nNode_Type[4] = N_POINTS_PRISM;         XDMF_Type[4] = 8;
+    Conn_Type[5] = Conn_Pyra_Par; nElem_Type[5] = nParallel_Pyra; nNode_Type[5] = N_POINTS_PYRAMID;       XDMF_Type[5] = 7;
+  }
+  
+  /*--- Mixed topology: every element is stored as its type followed by its
+   nodes (0-based), polylines also carry their number of nodes. ---*/
+  
+  for (iType = 0; iType < nType; iType++) {
+    nLocal_Elem += nElem_Type[iType];
+    nLocal_Conn += nElem_Type[iType]*(nNode_Type[iType]+1);
+    if (XDMF_Type[iType] == 2) nLocal_Conn += nElem_Type[iType];
+  }
+  
+  /*--- Offsets of this rank in the global arrays of points and elements. ---*/
+  
+  unsigned long Local_Count[3] = {nLocal, nLocal_Elem, nLocal_Conn};
+  unsigned long *Rank_Count = new unsigned long[3*size];
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(Local_Count, 3, MPI_UNSIGNED_LONG, Rank_Count, 3, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#else
+  for (iType = 0; iType < 3; iType++) Rank_Count[iType] = Local_Count[iType];
+#endif
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    if (iProcessor < rank) {
+      Point_Offset += Rank_Count[3*iProcessor];
+      Conn_Offset  += Rank_Count[3*iProcessor+2];
+    }
+    nGlobal_Poin += Rank_Count[3*iProcessor];
+    nGlobal_Elem += Rank_Count[3*iProcessor+1];
+    nGlobal_Conn += Rank_Count[3*iProcessor+2];
+  }
+  delete [] Rank_Count;
+  
+  /*--- Layout of the heavy data file: coordinates (interleaved), topology,
+   then one contiguous array per variable. ---*/
+  
+  unsigned long Conn_Start = nGlobal_Poin*nDim*sizeof(passivedouble);
+  unsigned long Var_Start  = Conn_Start + nGlobal_Conn*sizeof(int64_t);
+  
+  passivedouble *Coord_Buf = new passivedouble[nLocal*nDim];
+  passivedouble *Var_Buf   = new passivedouble[nLocal];
+  int64_t *Conn_Buf = new int64_t[nLocal_Conn];
+  
+  for (iPoint = 0; iPoint < nLocal; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      Coord_Buf[iPoint*nDim+iDim] = SU2_TYPE::GetValue(Data[iDim][iPoint]);
+  
+  iConn = 0;
+  for (iType = 0; iType < nType; iType++) {
+    for (iElem = 0; iElem < nElem_Type[iType]; iElem++) {
+      Conn_Buf[iConn++] = XDMF_Type[iType];
+      if (XDMF_Type[iType] == 2) Conn_Buf[iConn++] = nNode_Type[iType];
+      for (unsigned short iNode = 0; iNode < nNode_Type[iType]; iNode++)
+        Conn_Buf[iConn++] = Conn_Type[iType][iElem*nNode_Type[iType]+iNode]-1;
+    }
+  }
+  
+#ifdef HAVE_MPI
+  
+  /*--- All ranks write each array with one collective call. ---*/
+  
+  MPI_File fhw;
+  MPI_Status status;
+  MPI_Offset disp;
+  
+  int ierr = MPI_File_open(MPI_COMM_WORLD, (char *)(filename + ".bin").c_str(), MPI_MODE_CREATE|MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw);
+  if (ierr != MPI_SUCCESS) {
+    if (rank == MASTER_NODE)
+      cout << "Unable to open XDMF data file " << filename << ".bin." << endl;
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+  }
+  MPI_File_set_size(fhw, 0);
+  
+  disp = Point_Offset*nDim*sizeof(passivedouble);
+  MPI_File_write_at_all(fhw, disp, Coord_Buf, nLocal*nDim, MPI_DOUBLE, &status);
+  
+  disp = Conn_Start + Conn_Offset*sizeof(int64_t);
+  MPI_File_write_at_all(fhw, disp, Conn_Buf, nLocal_Conn, MPI_INT64_T, &status);
+  
+  for (iVar = nDim; iVar < nVar_Par; iVar++) {
+    for (iPoint = 0; iPoint < nLocal; iPoint++)
+      Var_Buf[iPoint] = SU2_TYPE::GetValue(Data[iVar][iPoint]);
+    disp = Var_Start + ((iVar-nDim)*nGlobal_Poin + Point_Offset)*sizeof(passivedouble);
+    MPI_File_write_at_all(fhw, disp, Var_Buf, nLocal, MPI_DOUBLE, &status);
+  }
+  
+  MPI_File_close(&fhw);
+  
+#else
+  
+  ofstream Data_File((filename + ".bin").c_str(), ios::out | ios::binary);
+  Data_File.write((char *)Coord_Buf, nLocal*nDim*sizeof(passivedouble));
+  Data_File.write((char *)Conn_Buf, nLocal_Conn*sizeof(int64_t));
+  for (iVar = nDim; iVar < nVar_Par; iVar++) {
+    for (iPoint = 0; iPoint < nLocal; iPoint++)
+      Var_Buf[iPoint] = SU2_TYPE::GetValue(Data[iVar][iPoint]);
+    Data_File.write((char *)Var_Buf, nLocal*sizeof(passivedouble));
+  }
+  Data_File.close();
+  
+#endif
+  
+  delete [] Coord_Buf;
+  delete [] Var_Buf;
+  delete [] Conn_Buf;
+  
+  /*--- The master describes the data in the .xmf file, and adds it to the
+   time series, if any (the series file is rewritten after every step). ---*/
+  
+  if (rank == MASTER_NODE) {
+    
+    unsigned short one = 1;
+    string endian = ((*(char *)&one) == 1 ? "Little" : "Big");
+    
+    ostringstream grid;
+    grid.precision(15);
+    
+    grid << "<Grid Name=\"" << (surf_sol ? "Surface" : "Volume") << "\" GridType=\"Uniform\">\n";
+    if (!series.empty())
+      grid << "<Time Value=\"" << Time << "\"/>\n";
+    grid << "<Topology TopologyType=\"Mixed\" NumberOfElements=\"" << nGlobal_Elem << "\">\n";
+    grid << "<DataItem Dimensions=\"" << nGlobal_Conn << "\" NumberType=\"Int\" Precision=\"8\" Format=\"Binary\" Endian=\"" << endian;
+    grid << "\" Seek=\"" << Conn_Start << "\">" << basename << "</DataItem>\n";
+    grid << "</Topology>\n";
+    grid << "<Geometry GeometryType=\"" << (nDim == 3 ? "XYZ" : "XY") << "\">\n";
+    grid << "<DataItem Dimensions=\"" << nGlobal_Poin << " " << nDim << "\" NumberType=\"Float\" Precision=\"8\" Format=\"Binary\" Endian=\"" << endian;
+    grid << "\" Seek=\"0\">" << basename << "</DataItem>\n";
+    grid << "</Geometry>\n";
+    for (iVar = nDim; iVar < nVar_Par; iVar++) {
+      grid << "<Attribute Name=\"" << Variable_Names[iVar] << "\" AttributeType=\"Scalar\" Center=\"Node\">\n";
+      grid << "<DataItem Dimensions=\"" << nGlobal_Poin << "\" NumberType=\"Float\" Precision=\"8\" Format=\"Binary\" Endian=\"" << endian;
+      grid << "\" Seek=\"" << Var_Start + (iVar-nDim)*nGlobal_Poin*sizeof(passivedouble) << "\">" << basename << "</DataItem>\n";
+      grid << "</Attribute>\n";
+    }
+    grid << "</Grid>\n";
+    
+    ofstream XDMF_File((filename + ".xmf").c_str(), ios::out);
+    XDMF_File << "<?xml version=\"1.0\" ?>\n";
+    XDMF_File << "<Xdmf Version=\"3.0\">\n<Domain>\n" << grid.str() << "</Domain>\n</Xdmf>\n";
+    XDMF_File.close();
+    
+    if (!series.empty()) {
+      
+      map<unsigned long, string>::iterator it;
+      XDMF_Series[series][Step] = grid.str();
+      
+      ofstream Series_File((series + ".xmf").c_str(), ios::out);
+      Series_File << "<?xml version=\"1.0\" ?>\n";
+      Series_File << "<Xdmf Version=\"3.0\">\n<Domain>\n";
+      Series_File << "<Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+      for (it = XDMF_Series[series].begin(); it != XDMF_Series[series].end(); it++)
+        Series_File << it->second;
+      Series_File << "</Grid>\n</Domain>\n</Xdmf>\n";
+      Series_File.close();
+      
+    }
+    
+  }
+  
+}
@@ -39,7 +39,7 @@ void COutput::SetParaview_ASCII(CConfig *config, CGeometry *geometry, unsigned s
   unsigned short Kind_Solver = config->GetKind_Solver();
     
   unsigned long iPoint, iElem, iNode;
-  unsigned long iExtIter = config->GetExtIter();
+  unsigned long iExtIter = Output_ExtIter;
   unsigned long *LocalIndex = NULL;
   bool *SurfacePoint = NULL;
   
@@ -694,17 +694,20 @@ void COutput::SetParaview_ASCII(CConfig *config, CGeometry *geometry, unsigned s
       }
       VarCounter++;
       
-      if (config->GetKind_Turb_Model() == SA_FIML) { //JRH 11242017
-    	  Paraview_File << "\nSCALARS Beta_Fiml float 1\n";
-		  Paraview_File << "LOOKUP_TABLE default\n";
-
-		  for (iPoint = 0; iPoint < nGlobal_Poin; iPoint++) {
-			if (! surf_sol) {
-			  /*--- Loop over the vars/residuals and write the values to file ---*/
-			  Paraview_File << scientific << Data[VarCounter][iPoint] << "\t";
-			}
-		  }
-		  VarCounter++;
+      for (iVar = 0; iVar < Field_Names.size(); iVar++) {
+        Paraview_File << "\nSCALARS " << Field_Names[iVar] << " float 1\n";
+        Paraview_File << "LOOKUP_TABLE default\n";
+        
+        for (iPoint = 0; iPoint < nGlobal_Poin; iPoint++) {
+          if (surf_sol) {
+            if (LocalIndex[iPoint+1] != 0) {
+              Paraview_File << scientific << Data[VarCounter][iPoint] << "\t";
+            }
+          } else {
+            Paraview_File << scientific << Data[VarCounter][iPoint] << "\t";
+          }
+        }
+        VarCounter++;
       }
 
     }
@@ -1771,3 +1774,346 @@ void COutput::SetParaview_MeshASCII(CConfig *config, CGeometry *geometry, unsign
   if (SurfacePoint != NULL) delete [] SurfacePoint;
   
 }
+
+void COutput::SetParaview_Binary_Parallel(CConfig *config, CGeometry *geometry, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol) {
+  
+  unsigned short iVar, iDim, iType, nType, nDim = geometry->GetnDim();
+  unsigned short Kind_Solver = config->GetKind_Solver();
+  
+  unsigned long iPoint, iElem, iNode, Global_Index, nLocal, nHalo = 0;
+  unsigned long nPiece_Poin, nPiece_Elem = 0, nPiece_Conn = 0;
+  unsigned long iExtIter = config->GetExtIter();
+  
+  bool adjoint = config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint();
+  
+  int iProcessor;
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  
+  char cstr[200], buffer[50];
+  string filename, piecename;
+  
+  /*--- Write file name without extension (same naming as the Tecplot
+   parallel writer). ---*/
+  
+  if (surf_sol) {
+    if (adjoint) filename = config->GetSurfAdjCoeff_FileName();
+    else filename = config->GetSurfFlowCoeff_FileName();
+  }
+  else {
+    if (adjoint) filename = config->GetAdj_FileName();
+    else filename = config->GetFlow_FileName();
+  }
+  
+  if (Kind_Solver == FEM_ELASTICITY) {
+    if (surf_sol) filename = config->GetSurfStructure_FileName().c_str();
+    else filename = config->GetStructure_FileName().c_str();
+  }
+  
+  if (Kind_Solver == WAVE_EQUATION) {
+    if (surf_sol) filename = config->GetSurfWave_FileName().c_str();
+    else filename = config->GetWave_FileName().c_str();
+  }
+  
+  if (Kind_Solver == HEAT_EQUATION) {
+    if (surf_sol) filename = config->GetSurfHeat_FileName().c_str();
+    else filename = config->GetHeat_FileName().c_str();
+  }
+  
+  if (Kind_Solver == POISSON_EQUATION) {
+    if (surf_sol) filename = config->GetSurfStructure_FileName().c_str();
+    else filename = config->GetStructure_FileName().c_str();
+  }
+  
+  if (config->GetKind_SU2() == SU2_DOT) {
+    if (surf_sol) filename = config->GetSurfSens_FileName();
+    else filename = config->GetVolSens_FileName();
+  }
+  
+  strcpy (cstr, filename.c_str());
+  
+  /*--- Special cases where a number needs to be appended to the file name. ---*/
+  
+  if ((Kind_Solver == EULER || Kind_Solver == NAVIER_STOKES || Kind_Solver == RANS ||
+       Kind_Solver == ADJ_EULER || Kind_Solver == ADJ_NAVIER_STOKES || Kind_Solver == ADJ_RANS ||
+       Kind_Solver == DISC_ADJ_EULER || Kind_Solver == DISC_ADJ_NAVIER_STOKES || Kind_Solver == DISC_ADJ_RANS) &&
+      (val_nZone > 1) ) {
+    SPRINTF (buffer, "_%d", SU2_TYPE::Int(val_iZone));
+    strcat(cstr, buffer);
+  }
+  
+  if (config->GetUnsteady_Simulation() && config->GetWrt_Unsteady() && config->GetUnsteady_Simulation() != HARMONIC_BALANCE) {
+    if (SU2_TYPE::Int(iExtIter) < 10) SPRINTF (buffer, "_0000%d", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 10) && (SU2_TYPE::Int(iExtIter) < 100)) SPRINTF (buffer, "_000%d", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 100) && (SU2_TYPE::Int(iExtIter) < 1000)) SPRINTF (buffer, "_00%d", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 1000) && (SU2_TYPE::Int(iExtIter) < 10000)) SPRINTF (buffer, "_0%d", SU2_TYPE::Int(iExtIter));
+    if (SU2_TYPE::Int(iExtIter) >= 10000) SPRINTF (buffer, "_%d", SU2_TYPE::Int(iExtIter));
+    strcat(cstr, buffer);
+  }
+  
+  filename = string(cstr);
+  
+  /*--- The pieces are referenced from the index file relative to its
+   own location. ---*/
+  
+  string basename = filename;
+  if (basename.find_last_of("/\\") != string::npos)
+    basename = basename.substr(basename.find_last_of("/\\")+1);
+  
+  /*--- Select the sorted point data and connectivity for this file. The
+   connectivity holds 1-based global indices in the numbering of the data
+   (volume numbering, or the renumbered surface points). ---*/
+  
+  su2double **Data = (surf_sol ? Parallel_Surf_Data : Parallel_Data);
+  nLocal = (surf_sol ? nSurf_Poin_Par : nParallel_Poin);
+  
+  int *Conn_Type[6];
+  unsigned long nElem_Type[6];
+  unsigned short nNode_Type[6];
+  unsigned char VTK_Type[6];
+  
+  if (surf_sol) {
+    nType = 3;
+    Conn_Type[0] = Conn_Line_Par;      nElem_Type[0] = nParallel_Line;      nNode_Type[0] = N_POINTS_LINE;          VTK_Type[0] = LINE;
+    Conn_Type[1] = Conn_BoundTria_Par; nElem_Type[1] = nParallel_BoundTria; nNode_Type[1] = N_POINTS_TRIANGLE;      VTK_Type[1] = TRIANGLE;
+    Conn_Type[2] = Conn_BoundQuad_Par; nElem_Type[2] = nParallel_BoundQuad; nNode_Type[2] = N_POINTS_QUADRILATERAL; VTK_Type[2] = QUADRILATERAL;
+  } else {
+    nType = 6;
+    Conn_Type[0] = Conn_Tria_Par; nElem_Type[0] = nParallel_Tria; nNode_Type[0] = N_POINTS_TRIANGLE;      VTK_Type[0] = TRIANGLE;
+    Conn_Type[1] = Conn_Quad_Par; nElem_Type[1] = nParallel_Quad; nNode_Type[1] = N_POINTS_QUADRILATERAL; VTK_Type[1] = QUADRILATERAL;
+    Conn_Type[2] = Conn_Tetr_Par; nElem_Type[2] = nParallel_Tetr; nNode_Type[2] = N_POINTS_TETRAHEDRON;   VTK_Type[2] = TETRAHEDRON;
+    Conn_Type[3] = Conn_Hexa_Par; nElem_Type[3] = nParallel_Hexa; nNode_Type[3] = N_POINTS_HEXAHEDRON;    VTK_Type[3] = HEXAHEDRON;
+    Conn_Type[4] = Conn_Pris_Par; nElem_Type[4] = nParallel_Pris; nNode_Type[4] = N_POINTS_PRISM;         VTK_Type[4] = PRISM;
+    Conn_Type[5] = Conn_Pyra_Par; nElem_Type[5] = nParallel_Pyra; nNode_Type[5] = N_POINTS_PYRAMID;       VTK_Type[5] = PYRAMID;
+  }
+  
+  for (iType = 0; iType < nType; iType++) {
+    nPiece_Elem += nElem_Type[iType];
+    nPiece_Conn += nElem_Type[iType]*nNode_Type[iType];
+  }
+  
+  /*--- Offsets of the linear partitioning of the points. ---*/
+  
+  unsigned long *nPoint_Linear = new unsigned long[size+1];
+  nPoint_Linear[0] = 0;
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(&nLocal, 1, MPI_UNSIGNED_LONG, &nPoint_Linear[1], 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#else
+  nPoint_Linear[1] = nLocal;
+#endif
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    nPoint_Linear[iProcessor+1] += nPoint_Linear[iProcessor];
+  
+  /*--- Elements are distributed by their lowest node index, so some of
+   their nodes may live on other ranks. Each piece must be self-contained,
+   thus collect those (sorted, unique) halo points and fetch their data. ---*/
+  
+  vector<unsigned long> Halo_Index;
+  for (iType = 0; iType < nType; iType++) {
+    for (iNode = 0; iNode < nElem_Type[iType]*nNode_Type[iType]; iNode++) {
+      Global_Index = Conn_Type[iType][iNode]-1;
+      if ((Global_Index < nPoint_Linear[rank]) || (Global_Index >= nPoint_Linear[rank+1]))
+        Halo_Index.push_back(Global_Index);
+    }
+  }
+  sort(Halo_Index.begin(), Halo_Index.end());
+  Halo_Index.erase(unique(Halo_Index.begin(), Halo_Index.end()), Halo_Index.end());
+  nHalo = Halo_Index.size();
+  
+  passivedouble *Halo_Data = new passivedouble[nHalo*nVar_Par];
+  
+#ifdef HAVE_MPI
+  
+  int *nPoint_Send = new int[size], *nPoint_Recv = new int[size];
+  int *Send_Displ = new int[size], *Recv_Displ = new int[size];
+  
+  for (iProcessor = 0; iProcessor < size; iProcessor++) nPoint_Send[iProcessor] = 0;
+  for (iPoint = 0; iPoint < nHalo; iPoint++) {
+    iProcessor = (upper_bound(nPoint_Linear, nPoint_Linear+size+1, Halo_Index[iPoint]) - nPoint_Linear) - 1;
+    nPoint_Send[iProcessor]++;
+  }
+  
+  MPI_Alltoall(nPoint_Send, 1, MPI_INT, nPoint_Recv, 1, MPI_INT, MPI_COMM_WORLD);
+  
+  Send_Displ[0] = 0; Recv_Displ[0] = 0;
+  for (iProcessor = 1; iProcessor < size; iProcessor++) {
+    Send_Displ[iProcessor] = Send_Displ[iProcessor-1] + nPoint_Send[iProcessor-1];
+    Recv_Displ[iProcessor] = Recv_Displ[iProcessor-1] + nPoint_Recv[iProcessor-1];
+  }
+  unsigned long nRequest = Recv_Displ[size-1] + nPoint_Recv[size-1];
+  
+  /*--- Send the requested indices to their owners (the halo list is
+   sorted, so the requests for each rank are already contiguous). ---*/
+  
+  unsigned long *Request_Index = new unsigned long[nRequest];
+  MPI_Alltoallv((nHalo > 0 ? &Halo_Index[0] : NULL), nPoint_Send, Send_Displ, MPI_UNSIGNED_LONG,
+                Request_Index, nPoint_Recv, Recv_Displ, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  
+  /*--- Answer with the data of the requested points. ---*/
+  
+  passivedouble *Reply_Data = new passivedouble[nRequest*nVar_Par];
+  for (iPoint = 0; iPoint < nRequest; iPoint++)
+    for (iVar = 0; iVar < nVar_Par; iVar++)
+      Reply_Data[iPoint*nVar_Par+iVar] = SU2_TYPE::GetValue(Data[iVar][Request_Index[iPoint]-nPoint_Linear[rank]]);
+  
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    nPoint_Send[iProcessor] *= nVar_Par; Send_Displ[iProcessor] *= nVar_Par;
+    nPoint_Recv[iProcessor] *= nVar_Par; Recv_Displ[iProcessor] *= nVar_Par;
+  }
+  
+  MPI_Alltoallv(Reply_Data, nPoint_Recv, Recv_Displ, MPI_DOUBLE,
+                Halo_Data, nPoint_Send, Send_Displ, MPI_DOUBLE, MPI_COMM_WORLD);
+  
+  delete [] Request_Index;
+  delete [] Reply_Data;
+  delete [] nPoint_Send; delete [] nPoint_Recv;
+  delete [] Send_Displ;  delete [] Recv_Displ;
+  
+#endif
+  
+  nPiece_Poin = nLocal + nHalo;
+  
+  /*--- Build the piece: local points first, then the halo points. ---*/
+  
+  passivedouble *Coords = new passivedouble[nPiece_Poin*3];
+  for (iPoint = 0; iPoint < nLocal; iPoint++) {
+    for (iDim = 0; iDim < 3; iDim++)
+      Coords[iPoint*3+iDim] = (iDim < nDim ? SU2_TYPE::GetValue(Data[iDim][iPoint]) : 0.0);
+  }
+  for (iPoint = 0; iPoint < nHalo; iPoint++) {
+    for (iDim = 0; iDim < 3; iDim++)
+      Coords[(nLocal+iPoint)*3+iDim] = (iDim < nDim ? Halo_Data[iPoint*nVar_Par+iDim] : 0.0);
+  }
+  
+  int64_t *Elem_Conn   = new int64_t[nPiece_Conn];
+  int64_t *Elem_Offset = new int64_t[nPiece_Elem];
+  unsigned char *Elem_Type = new unsigned char[nPiece_Elem];
+  
+  iElem = 0; iNode = 0;
+  for (iType = 0; iType < nType; iType++) {
+    for (unsigned long jElem = 0; jElem < nElem_Type[iType]; jElem++) {
+      for (unsigned short jNode = 0; jNode < nNode_Type[iType]; jNode++) {
+        Global_Index = Conn_Type[iType][jElem*nNode_Type[iType]+jNode]-1;
+        if ((Global_Index >= nPoint_Linear[rank]) && (Global_Index < nPoint_Linear[rank+1]))
+          Elem_Conn[iNode] = Global_Index - nPoint_Linear[rank];
+        else
+          Elem_Conn[iNode] = nLocal + (lower_bound(Halo_Index.begin(), Halo_Index.end(), Global_Index) - Halo_Index.begin());
+        iNode++;
+      }
+      Elem_Offset[iElem] = iNode;
+      Elem_Type[iElem]   = VTK_Type[iType];
+      iElem++;
+    }
+  }
+  
+  /*--- Raw appended data: every block is prefixed with its size in bytes. ---*/
+  
+  unsigned short one = 1;
+  string byte_order = ((*(char *)&one) == 1 ? "LittleEndian" : "BigEndian");
+  uint64_t nBytes, Data_Offset = 0;
+  
+  sprintf(buffer, "_%d.vtu", rank);
+  piecename = filename + string(buffer);
+  
+  ofstream Piece_File(piecename.c_str(), ios::out | ios::binary);
+  
+  Piece_File << "<?xml version=\"1.0\"?>\n";
+  Piece_File << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << byte_order << "\" header_type=\"UInt64\">\n";
+  Piece_File << "<UnstructuredGrid>\n";
+  Piece_File << "<Piece NumberOfPoints=\"" << nPiece_Poin << "\" NumberOfCells=\"" << nPiece_Elem << "\">\n";
+  
+  Piece_File << "<Points>\n";
+  Piece_File << "<DataArray type=\"Float64\" Name=\"Points\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" << Data_Offset << "\"/>\n";
+  Data_Offset += sizeof(uint64_t) + nPiece_Poin*3*sizeof(passivedouble);
+  Piece_File << "</Points>\n";
+  
+  Piece_File << "<Cells>\n";
+  Piece_File << "<DataArray type=\"Int64\" Name=\"connectivity\" format=\"appended\" offset=\"" << Data_Offset << "\"/>\n";
+  Data_Offset += sizeof(uint64_t) + nPiece_Conn*sizeof(int64_t);
+  Piece_File << "<DataArray type=\"Int64\" Name=\"offsets\" format=\"appended\" offset=\"" << Data_Offset << "\"/>\n";
+  Data_Offset += sizeof(uint64_t) + nPiece_Elem*sizeof(int64_t);
+  Piece_File << "<DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"" << Data_Offset << "\"/>\n";
+  Data_Offset += sizeof(uint64_t) + nPiece_Elem*sizeof(unsigned char);
+  Piece_File << "</Cells>\n";
+  
+  Piece_File << "<PointData>\n";
+  for (iVar = nDim; iVar < nVar_Par; iVar++) {
+    Piece_File << "<DataArray type=\"Float64\" Name=\"" << Variable_Names[iVar] << "\" format=\"appended\" offset=\"" << Data_Offset << "\"/>\n";
+    Data_Offset += sizeof(uint64_t) + nPiece_Poin*sizeof(passivedouble);
+  }
+  Piece_File << "</PointData>\n";
+  
+  Piece_File << "</Piece>\n";
+  Piece_File << "</UnstructuredGrid>\n";
+  Piece_File << "<AppendedData encoding=\"raw\">\n_";
+  
+  nBytes = nPiece_Poin*3*sizeof(passivedouble);
+  Piece_File.write((char *)&nBytes, sizeof(uint64_t));
+  Piece_File.write((char *)Coords, nBytes);
+  
+  nBytes = nPiece_Conn*sizeof(int64_t);
+  Piece_File.write((char *)&nBytes, sizeof(uint64_t));
+  Piece_File.write((char *)Elem_Conn, nBytes);
+  
+  nBytes = nPiece_Elem*sizeof(int64_t);
+  Piece_File.write((char *)&nBytes, sizeof(uint64_t));
+  Piece_File.write((char *)Elem_Offset, nBytes);
+  
+  nBytes = nPiece_Elem*sizeof(unsigned char);
+  Piece_File.write((char *)&nBytes, sizeof(uint64_t));
+  Piece_File.write((char *)Elem_Type, nBytes);
+  
+  /*--- Point data, one variable at a time (reuse the coordinate buffer). ---*/
+  
+  nBytes = nPiece_Poin*sizeof(passivedouble);
+  for (iVar = nDim; iVar < nVar_Par; iVar++) {
+    for (iPoint = 0; iPoint < nLocal; iPoint++)
+      Coords[iPoint] = SU2_TYPE::GetValue(Data[iVar][iPoint]);
+    for (iPoint = 0; iPoint < nHalo; iPoint++)
+      Coords[nLocal+iPoint] = Halo_Data[iPoint*nVar_Par+iVar];
+    Piece_File.write((char *)&nBytes, sizeof(uint64_t));
+    Piece_File.write((char *)Coords, nBytes);
+  }
+  
+  Piece_File << "\n</AppendedData>\n";
+  Piece_File << "</VTKFile>\n";
+  Piece_File.close();
+  
+  /*--- The master writes the index of all the pieces. ---*/
+  
+  if (rank == MASTER_NODE) {
+    
+    ofstream Index_File((filename + ".pvtu").c_str(), ios::out);
+    
+    Index_File << "<?xml version=\"1.0\"?>\n";
+    Index_File << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\"" << byte_order << "\" header_type=\"UInt64\">\n";
+    Index_File << "<PUnstructuredGrid GhostLevel=\"0\">\n";
+    Index_File << "<PPoints>\n";
+    Index_File << "<PDataArray type=\"Float64\" Name=\"Points\" NumberOfComponents=\"3\"/>\n";
+    Index_File << "</PPoints>\n";
+    Index_File << "<PPointData>\n";
+    for (iVar = nDim; iVar < nVar_Par; iVar++)
+      Index_File << "<PDataArray type=\"Float64\" Name=\"" << Variable_Names[iVar] << "\"/>\n";
+    Index_File << "</PPointData>\n";
+    for (iProcessor = 0; iProcessor < size; iProcessor++) {
+      sprintf(buffer, "_%d.vtu", iProcessor);
+      Index_File << "<Piece Source=\"" << basename << buffer << "\"/>\n";
+    }
+    Index_File << "</PUnstructuredGrid>\n";
+    Index_File << "</VTKFile>\n";
+    Index_File.close();
+    
+  }
+  
+  delete [] nPoint_Linear;
+  delete [] Halo_Data;
+  delete [] Coords;
+  delete [] Elem_Conn;
+  delete [] Elem_Offset;
+  delete [] Elem_Type;
+  
+}
@@ -86,6 +86,8 @@ COutput::COutput(void) {
   Local_Data         = NULL;
   Parallel_Data      = NULL;
   Parallel_Surf_Data = NULL;
+  Local_Filter       = NULL;
+  Parallel_Filter    = NULL;
   
   /*--- Initialize CGNS write flag ---*/
   
@@ -112,6 +114,22 @@ COutput::COutput(void) {
 
   Sum_Total_RadialDistortion = 0.0;
   Sum_Total_CircumferentialDistortion = 0.0;
+  
+  /*--- Initialize the staged (asynchronous) output ---*/
+  
+  Output_ExtIter       = 0;
+  Output_Thread_Active = false;
+  Staged_Config   = NULL;
+  Staged_Geometry = NULL;
+  Staged_Solver   = NULL;
+  Staged_iZone = 0;  Staged_nZone = 0;
+  Staged_Vol = false;  Staged_Srf = false;  Staged_Async = false;
+  
+  /*--- Initialize the history stream (opened with the first record) ---*/
+  
+  Stream_Format = NO_STREAM;
+  Stream_Batch  = 1;
+  for (unsigned short iPhase = 0; iPhase < 4; iPhase++) Phase_Time[iPhase] = 0.0;
 
 }
 
@@ -120,6 +138,18 @@ COutput::~COutput(void) {
   /* Coords and Conn_*(Connectivity) have their own dealloc functions */
   /* Data is taken care of in DeallocateSolution function */
   
+  /*--- Do not leave a background write behind (the merged data is
+   released by WaitResult_Files, while the geometry is still alive) ---*/
+  
+  if (Output_Thread_Active) pthread_join(Output_Thread, NULL);
+  
+  /*--- Write the last records of the history stream ---*/
+  
+  if (Stream_Format != NO_STREAM) {
+    WriteHistoryStream();
+    Stream_File.close();
+  }
+  
 }
 
 void COutput::SetSurfaceCSV_Flow(CConfig *config, CGeometry *geometry,
@@ -1996,7 +2026,7 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
   unsigned short iVar_GridVel = 0, iVar_PressCp = 0, iVar_Lam = 0, iVar_MachMean = 0,
   iVar_ViscCoeffs = 0, iVar_HeatCoeffs = 0, iVar_Sens = 0, iVar_Extra = 0, iVar_Eddy = 0, iVar_Sharp = 0,
   iVar_FEA_Vel = 0, iVar_FEA_Accel = 0, iVar_FEA_Stress = 0, iVar_FEA_Stress_3D = 0,
-  iVar_FEA_Extra = 0, iVar_SensDim = 0, iVar_Fiml = 0;
+  iVar_FEA_Extra = 0, iVar_SensDim = 0, iVar_Fiml = 0, iVar_Fields = 0, nVar_Fields = 0;
   unsigned long iPoint = 0, jPoint = 0, iVertex = 0, iMarker = 0;
   su2double Gas_Constant, Mach2Vel, Mach_Motion, RefDensity, RefPressure = 0.0, factor = 0.0;
   
@@ -2023,7 +2053,6 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
   bool compressible   = (config->GetKind_Regime() == COMPRESSIBLE);
   bool incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
   bool transition     = (config->GetKind_Trans_Model() == LM);
-  bool transition_BC = (config->GetKind_Trans_Model()== BC); //JRH 05032018
   bool flow           = (( config->GetKind_Solver() == EULER             ) ||
                          ( config->GetKind_Solver() == NAVIER_STOKES     ) ||
                          ( config->GetKind_Solver() == RANS              ) ||
@@ -2032,7 +2061,6 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
                          ( config->GetKind_Solver() == ADJ_RANS          )   );
   bool fem = (config->GetKind_Solver() == FEM_ELASTICITY);
   bool fiml = (config->GetKind_Turb_Model() == SA_FIML && Kind_Solver == DISC_ADJ_RANS); //If true, output beta_fiml and beta_fiml_grad at each node - 05032017
-  bool fiml_direct = (config->GetKind_Turb_Model() == SA_FIML && Kind_Solver == RANS); //If true, direct solution, only write beta_fiml JRH 11242017
   bool train_nn = (config->GetTrainNN()); //JRH 04242018 - Whether we trained a Neural Network, output weights if true
   
   unsigned short iDim;
@@ -2059,6 +2087,10 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
     factor = 1.0 / (0.5*RefDensity*RefAreaCoeff*RefVel2);
   }
   
+  /*--- Iteration of the merged solution, used by the writers. ---*/
+  
+  Output_ExtIter = config->GetExtIter();
+  
   /*--- Prepare send buffers for the conservative variables. Need to
    find the total number of conservative variables and also the
    index for their particular solution container. ---*/
@@ -2127,17 +2159,15 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
     
     if (Kind_Solver == RANS) {
       iVar_Eddy = nVar_Total; nVar_Total += 1;
-      if (fiml_direct) {
-    	  iVar_Fiml = nVar_Total; //JRH 11242017
-    	  nVar_Total += 1; // JRH 11242017 - Beta_Fiml
-    	  nVar_Total += 11; // JRH 02062018 - ML Feature Variables
-    	  if (transition_BC) {
-    		  nVar_Total += 1; //JRH 03052018 - Output Intermittancy
-    	  }
-    	  if (config->GetTrainNN()) {
-    		  nVar_Total += 1; //JRH 05062018 - Output Beta Fiml Train if training NN
-    	  }
-      }
+      
+      /*--- Per-point fields registered by the turbulence solver (FIML
+       correction and features). ---*/
+      
+      Field_Names.clear();
+      nVar_Fields = solver[TURB_SOL]->GetnOutputFields();
+      for (jVar = 0; jVar < nVar_Fields; jVar++)
+        Field_Names.push_back(solver[TURB_SOL]->GetOutputField_Name(jVar));
+      iVar_Fields = nVar_Total; nVar_Total += nVar_Fields;
     }
     
     /*--- Add Sharp edges to the restart file ---*/
@@ -2887,724 +2917,63 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
           jPoint = (iProcessor+1)*nBuffer_Scalar;
         }
       }
-      if (fiml_direct) { //JRH 11242017
-      		//if (rank == MASTER_NODE) cout << "JRH Debugging: In COutput::MergeSolution - Adding beta_fiml to Data[" << iVar_Fiml << "][jPoint]" << endl;
-  			/*--- Loop over this partition to collect the current variable ---*/
-  			/*******************************************FIML VARIABLE OUTPUT - JRH************************************/
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetBetaFiml();
-  				//Buffer_Send_Var[jPoint] = (solver[TURB_SOL]->node[iPoint]->GetBetaFiml()-1.0)/geometry->node[iPoint]->GetVolume()+1.0;
-
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0; iVar = iVar_Fiml;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar+0][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/***********************************************JRH 02072018 - OUTPUT PRODUCTION*********************************************/
-      		//if (rank == MASTER_NODE) cout << "JRH Debugging: In COutput::MergeSolution - Adding beta_fiml to Data[" << iVar_Fiml << "][jPoint]" << endl;
-  			/*--- Loop over this partition to collect the current variable ---*/
-  			/*******************************************FIML FEATURE #1 OUTPUT - JRH************************************/
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetProduction();
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0; iVar = iVar_Fiml+1;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/********************************************************JRH - END PRODUCTION GATHERING**************************************************************/
-  			/***********************************************JRH 02072018 - OUTPUT DESTRUCTION*********************************************/
-      		//if (rank == MASTER_NODE) cout << "JRH Debugging: In COutput::MergeSolution - Adding beta_fiml to Data[" << iVar_Fiml << "][jPoint]" << endl;
-  			/*--- Loop over this partition to collect the current variable ---*/
-  			/*******************************************FIML FEATURE #2 OUTPUT - JRH************************************/
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetDestruction();
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0; iVar = iVar_Fiml+2;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/********************************************************JRH - END DESTRUCTION GATHERING**************************************************************/
-  			/***********************************************JRH 02072018 - OUTPUT STildeSA*********************************************/
-      		//if (rank == MASTER_NODE) cout << "JRH Debugging: In COutput::MergeSolution - Adding beta_fiml to Data[" << iVar_Fiml << "][jPoint]" << endl;
-  			/*--- Loop over this partition to collect the current variable ---*/
-  			/*******************************************FIML FEATURE #3 OUTPUT - JRH************************************/
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetSTildeSA();
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0; iVar = iVar_Fiml+3;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/********************************************************JRH - END STildeSA GATHERING**************************************************************/
-  			/***********************************************JRH 02072018 - OUTPUT ChiSA*********************************************/
-      		//if (rank == MASTER_NODE) cout << "JRH Debugging: In COutput::MergeSolution - Adding beta_fiml to Data[" << iVar_Fiml << "][jPoint]" << endl;
-  			/*--- Loop over this partition to collect the current variable ---*/
-  			/*******************************************FIML FEATURE #4 OUTPUT - JRH************************************/
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetChiSA();
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0; iVar = iVar_Fiml+4;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/********************************************************JRH - END ChiSA GATHERING**************************************************************/
-  			/***********************************************JRH 02072018 - OUTPUT Delta_Criterion*********************************************/
-      		//if (rank == MASTER_NODE) cout << "JRH Debugging: In COutput::MergeSolution - Adding beta_fiml to Data[" << iVar_Fiml << "][jPoint]" << endl;
-  			/*--- Loop over this partition to collect the current variable ---*/
-  			/*******************************************FIML FEATURE #5 OUTPUT - JRH************************************/
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetDeltaCriterion();
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0; iVar = iVar_Fiml+5;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/********************************************************JRH - END Delta_Criterion GATHERING**************************************************************/
-  			/***********************************************JRH 02072018 - OUTPUT FwSA*********************************************/
-      		//if (rank == MASTER_NODE) cout << "JRH Debugging: In COutput::MergeSolution - Adding beta_fiml to Data[" << iVar_Fiml << "][jPoint]" << endl;
-  			/*--- Loop over this partition to collect the current variable ---*/
-  			/*******************************************FIML FEATURE #6 OUTPUT - JRH************************************/
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetFwSA();
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0; iVar = iVar_Fiml+6;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/********************************************************JRH - END FwSA GATHERING**************************************************************/
-  			/***********************************************JRH 02072018 - OUTPUT RSA*********************************************/
-      		//if (rank == MASTER_NODE) cout << "JRH Debugging: In COutput::MergeSolution - Adding beta_fiml to Data[" << iVar_Fiml << "][jPoint]" << endl;
-  			/*--- Loop over this partition to collect the current variable ---*/
-  			/*******************************************FIML FEATURE #7 OUTPUT - JRH************************************/
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetRSA();
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0; iVar = iVar_Fiml+7;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/********************************************************JRH - END RSA GATHERING**************************************************************/
-  			/***********************************************JRH 02072018 - OUTPUT Strain Rate Magnitude*********************************************/
-      		//if (rank == MASTER_NODE) cout << "JRH Debugging: In COutput::MergeSolution - Adding beta_fiml to Data[" << iVar_Fiml << "][jPoint]" << endl;
-  			/*--- Loop over this partition to collect the current variable ---*/
-  			/*******************************************FIML FEATURE #8 OUTPUT - JRH************************************/
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetStrainMagnitude();
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0; iVar = iVar_Fiml+8;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/********************************************************JRH - END Strain Rate Magnitude GATHERING**************************************************************/
-  			/***********************************************JRH 02072018 - OUTPUT Vorticity Magnitude*********************************************/
-      		//if (rank == MASTER_NODE) cout << "JRH Debugging: In COutput::MergeSolution - Adding beta_fiml to Data[" << iVar_Fiml << "][jPoint]" << endl;
-  			/*--- Loop over this partition to collect the current variable ---*/
-  			/*******************************************FIML FEATURE #9 OUTPUT - JRH************************************/
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetVorticityMagnitude();
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0; iVar = iVar_Fiml+9;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/********************************************************JRH - END Vorticity Magnitude GATHERING**************************************************************/
-  			/***********************************************JRH 03052018 - OUTPUT Wall Distance*********************************************/
-      		//if (rank == MASTER_NODE) cout << "JRH Debugging: In COutput::MergeSolution - Adding beta_fiml to Data[" << iVar_Fiml << "][jPoint]" << endl;
-  			/*--- Loop over this partition to collect the current variable ---*/
-  			/*******************************************FIML FEATURE #10 OUTPUT - JRH************************************/
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetWallDist();
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0; iVar = iVar_Fiml+10;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/********************************************************JRH - END Wall Dist GATHERING*************************************************************/
-  			/*******************************************FIML FEATURE #11 OUTPUT - JRH************************************/
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetDES_fd();
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0; iVar = iVar_Fiml+11;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/********************************************************JRH - END Shielding Function GATHERING*************************************************
-  			/***********************************************JRH 03052018 - OUTPUT Gamma Transition*********************************************/
-      		//if (rank == MASTER_NODE) cout << "JRH Debugging: In COutput::MergeSolution - Adding beta_fiml to Data[" << iVar_Fiml << "][jPoint]" << endl;
-  			/*--- Loop over this partition to collect the current variable ---*/
-  			/*******************************************FIML FEATURE #12 OUTPUT - JRH************************************/
-  			if (transition_BC) {
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetGammaTrans();
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0; iVar = iVar_Fiml+12;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/********************************************************JRH - END Gamma Transition Gathering*************************************************************/
-  			} //<== if (transition_BC)
-      		//if (rank == MASTER_NODE) cout << "JRH Debugging: In COutput::MergeSolution - Adding beta_fiml to Data[" << iVar_Fiml << "][jPoint]" << endl;
-  			/*--- Loop over this partition to collect the current variable ---*/
-  			/*******************************************FIML FEATURE #13 OUTPUT - JRH************************************/
-  			if (config->GetTrainNN()) {
-  			jPoint = 0;
-  			for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-
-  			  /*--- Check for halos & write only if requested ---*/
-
-  			 if (!Local_Halo[iPoint] || Wrt_Halo) {
-
-  				/*--- Load buffers with the skin friction, heat transfer, y+ variables. ---*/
-
-  				Buffer_Send_Var[jPoint] = solver[TURB_SOL]->node[iPoint]->GetBetaFimlTrain();
-  				//cout << "Buffer_Send_Var[" << jPoint << "] = " << solver[TURB_SOL]->node[iPoint]->GetBetaFiml() << endl;
-  				//Buffer_Send_Res[jPoint] = solver[ADJTURB_SOL]->GetBetaFimlGrad(iPoint);
-  				jPoint++;
-  			}
-  		}
-  			/*--- Gather the data on the master node. ---*/
-
-  #ifdef HAVE_MPI
-  			SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  			//SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  #else
-  			for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
-  			//for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
-  #endif
-
-  			/*--- The master node unpacks and sorts this variable by global index ---*/
-
-  			if (rank == MASTER_NODE) {
-  			  jPoint = 0;
-  			  if (!transition_BC) iVar = iVar_Fiml+12;
-  			  else iVar = iVar_Fiml+13;
-  			  for (iProcessor = 0; iProcessor < size; iProcessor++) {
-  				for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
-
-  				  /*--- Get global index, then loop over each variable and store ---*/
-
-  				  iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
-  				  Data[iVar][iGlobal_Index] = Buffer_Recv_Var[jPoint];
-  				  //cout << "Data[" << iVar+0 << "][" <<iGlobal_Index<<"]=Buffer_Recv_Var["<< jPoint << "]=" << Buffer_Recv_Var[jPoint] << endl;
-  				  //Data[iVar+1][iGlobal_Index] = Buffer_Recv_Res[jPoint];
-  				  jPoint++;
-  				}
-
-  				/*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
-
-  				jPoint = (iProcessor+1)*nBuffer_Scalar;
-  			  }
-  			}
-  			/********************************************************JRH - END BetaFimlTrain Gathering*************************************************************/
-  			} //<== if (GetTrainNN())
-  		} //<===  if (fiml_direct)
+      
+      /*--- Communicate the registered per-point fields. All of them are
+       packed in a single buffer per rank and gathered at once. ---*/
+      
+      if (nVar_Fields > 0) {
+        
+        su2double *Buffer_Send_Fields = new su2double[nBuffer_Scalar*nVar_Fields];
+        su2double *Buffer_Recv_Fields = NULL;
+        if (rank == MASTER_NODE) Buffer_Recv_Fields = new su2double[size*nBuffer_Scalar*nVar_Fields];
+        
+        /*--- Loop over this partition to collect the fields ---*/
+        
+        jPoint = 0;
+        for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+          
+          /*--- Check for halos & write only if requested ---*/
+          
+          if (!Local_Halo[iPoint] || Wrt_Halo) {
+            for (jVar = 0; jVar < nVar_Fields; jVar++)
+              Buffer_Send_Fields[jPoint*nVar_Fields+jVar] = solver[TURB_SOL]->GetOutputField(jVar, iPoint);
+            jPoint++;
+          }
+        }
+        
+        /*--- Gather the data on the master node. ---*/
+        
+#ifdef HAVE_MPI
+        SU2_MPI::Gather(Buffer_Send_Fields, nBuffer_Scalar*nVar_Fields, MPI_DOUBLE, Buffer_Recv_Fields, nBuffer_Scalar*nVar_Fields, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+#else
+        for (iPoint = 0; iPoint < nBuffer_Scalar*nVar_Fields; iPoint++) Buffer_Recv_Fields[iPoint] = Buffer_Send_Fields[iPoint];
+#endif
+        
+        /*--- The master node unpacks and sorts the fields by global index ---*/
+        
+        if (rank == MASTER_NODE) {
+          jPoint = 0;
+          for (iProcessor = 0; iProcessor < size; iProcessor++) {
+            for (iPoint = 0; iPoint < Buffer_Recv_nPoint[iProcessor]; iPoint++) {
+              
+              /*--- Get global index, then loop over each variable and store ---*/
+              
+              iGlobal_Index = Buffer_Recv_GlobalIndex[jPoint];
+              for (jVar = 0; jVar < nVar_Fields; jVar++)
+                Data[iVar_Fields+jVar][iGlobal_Index] = Buffer_Recv_Fields[jPoint*nVar_Fields+jVar];
+              jPoint++;
+            }
+            
+            /*--- Adjust jPoint to index of next proc's data in the buffers. ---*/
+            
+            jPoint = (iProcessor+1)*nBuffer_Scalar;
+          }
+        }
+        
+        delete [] Buffer_Send_Fields;
+        if (rank == MASTER_NODE) delete [] Buffer_Recv_Fields;
+        
+      }
       if (train_nn && rank == MASTER_NODE) solver[TURB_SOL]->WriteNNWeights();
     }
     
@@ -4248,6 +3617,7 @@ void COutput::MergeBaselineSolution(CConfig *config, CGeometry *geometry, CSolve
   unsigned long iPoint = 0, jPoint = 0;
   
   nVar_Total = config->fields.size() - 1;
+  Output_ExtIter = config->GetExtIter();
   
   /*--- Merge the solution either in serial or parallel. ---*/
   
@@ -4471,18 +3841,13 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
   unsigned short nZone = geometry->GetnZone();
   unsigned short Kind_Solver  = config->GetKind_Solver();
   unsigned short iVar, iDim, nDim = geometry->GetnDim();
-  unsigned long iPoint, iExtIter = config->GetExtIter();
+  unsigned long iPoint, iExtIter = Output_ExtIter;
   bool grid_movement = config->GetGrid_Movement();
   bool dynamic_fem = (config->GetDynamic_Analysis() == DYNAMIC);
   bool fem = (config->GetKind_Solver() == FEM_ELASTICITY);
   ofstream restart_file;
   string filename;
-  bool adjoint = config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint();
-  bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
-                    (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   bool fiml = (config->GetKind_Turb_Model() == SA_FIML && config->GetKind_Solver() == DISC_ADJ_RANS);
-  bool fiml_direct = (config->GetKind_Turb_Model() == SA_FIML && config->GetKind_Solver() == RANS);
-  bool trans_BC = (config->GetKind_Trans_Model() == BC);
 
   /*--- Retrieve filename from config ---*/
   
@@ -4577,11 +3942,8 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
         restart_file << "\t\"Eddy_Viscosity\"";
       } else
         restart_file << "\t\"<greek>m</greek><sub>t</sub>\"";
-      if (fiml_direct) {
-    	  restart_file << "\t\"<greek>b</greek>\"\t\"Production\"\t\"Destruction\"\t\"S<sub>hat</sub>\"\t\"<greek>X</greek>\"\t\"<greek>d</greek>\"\t\"f<sub>w</sub>\"\t\"r\"\t\"Strain_Mag\"\t\"Vort_Mag\"\t\"wall_dist\"\t\"f<sub>d</sub>\""; //JRH 11242017
-    	  if (trans_BC) restart_file << "\t\"<greek>g</greek>\"";
-    	  if (config->GetTrainNN()) restart_file << "\t\"<greek>b</greek><sub>train</sub>\"";
-      }
+      for (iVar = 0; iVar < Field_Names.size(); iVar++)
+        restart_file << "\t\"" << Field_Names[iVar] << "\"";
     }
     
     if (config->GetWrt_SharpEdges()) {
@@ -4667,17 +4029,9 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
     restart_file << "\n";
   }
   
-  /*--- Write the general header and flow conditions ----*/
+  /*--- Write the general header and flow conditions (see StageResult_Files) ----*/
   
-  restart_file <<"AOA= " << config->GetAoA() - config->GetAoA_Offset() << endl;
-  restart_file <<"SIDESLIP_ANGLE= " << config->GetAoS() - config->GetAoS_Offset() << endl;
-  restart_file <<"INITIAL_BCTHRUST= " << config->GetInitial_BCThrust() << endl;
-  restart_file <<"DCD_DCL_VALUE= " << config->GetdCD_dCL() << endl;
-  if (adjoint) restart_file << "SENS_AOA=" << solver[ADJFLOW_SOL]->GetTotal_Sens_AoA() * PI_NUMBER / 180.0 << endl;
-  if (dual_time)
-    restart_file <<"EXT_ITER= " << config->GetExtIter() + 1 << endl;
-  else
-    restart_file <<"EXT_ITER= " << config->GetExtIter() + config->GetExtIter_OffSet() + 1 << endl;
+  restart_file << Restart_Metadata;
   
   restart_file.close();
   
@@ -4801,7 +4155,9 @@ void COutput::SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config) {
       (config->GetOutput_FileFormat() == FIELDVIEW)) SPRINTF (buffer, ".dat");
   else if ((config->GetOutput_FileFormat() == TECPLOT_BINARY) ||
            (config->GetOutput_FileFormat() == FIELDVIEW_BINARY))  SPRINTF (buffer, ".plt");
-  else if (config->GetOutput_FileFormat() == PARAVIEW)  SPRINTF (buffer, ".vtk");
+  else if ((config->GetOutput_FileFormat() == PARAVIEW) ||
+           (config->GetOutput_FileFormat() == PARAVIEW_BINARY))  SPRINTF (buffer, ".vtk");
+  else if (config->GetOutput_FileFormat() == XDMF)  SPRINTF (buffer, ".csv");
   strcat(cstr, buffer);
   
   ConvHist_file->open(cstr, ios::out);
@@ -4943,6 +4299,102 @@ void COutput::SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config) {
 }
 
 
+void COutput::AddHistoryStream_Value(const char *val_name, su2double val_value) {
+  
+  if (Stream_Format == NO_STREAM) Stream_Fields.push_back(string(val_name));
+  Stream_Record.push_back(SU2_TYPE::GetValue(val_value));
+  
+}
+
+void COutput::SetHistoryStream_Record(CConfig *config) {
+  
+  unsigned short iField;
+  
+  /*--- The first record fixes the schema: open the file and write it as a
+   single JSON line, so that a reader only needs to parse that line and can
+   then load the records directly (e.g. with numpy.fromfile for BINARY). ---*/
+  
+  if (Stream_Format == NO_STREAM) {
+    
+    Stream_Format = config->GetKind_History_Stream();
+    Stream_Batch  = max(config->GetHistory_Stream_Batch(), (unsigned long)1);
+    
+    string filename = config->GetConv_FileName();
+    if (Stream_Format == STREAM_BINARY) filename += ".hist";
+    else filename += ".jsonl";
+    
+    if (Stream_Format == STREAM_BINARY) Stream_File.open(filename.c_str(), ios::out | ios::binary);
+    else Stream_File.open(filename.c_str(), ios::out);
+    
+    if (!Stream_File.is_open()) {
+      cout << "Error: could not open the history stream file " << filename << "." << endl;
+      exit(EXIT_FAILURE);
+    }
+    
+    int endian_test = 1;
+    bool little_endian = (*(char *)&endian_test == 1);
+    
+    Stream_File << "{\"format\": \"SU2_HISTORY_STREAM\", \"version\": 1, ";
+    if (Stream_Format == STREAM_BINARY) {
+      Stream_File << "\"encoding\": \"float64\", \"byte_order\": \"" << (little_endian ? "little" : "big") << "\", ";
+    } else {
+      Stream_File << "\"encoding\": \"json\", ";
+    }
+    Stream_File << "\"fields\": [";
+    for (iField = 0; iField < Stream_Fields.size(); iField++) {
+      if (iField > 0) Stream_File << ", ";
+      Stream_File << "\"" << Stream_Fields[iField] << "\"";
+    }
+    Stream_File << "]}\n";
+    Stream_File.flush();
+    
+  }
+  
+  /*--- Records that do not match the schema (it cannot change during a run)
+   are discarded rather than corrupting the stream. ---*/
+  
+  if (Stream_Record.size() == Stream_Fields.size())
+    Stream_Buffer.insert(Stream_Buffer.end(), Stream_Record.begin(), Stream_Record.end());
+  Stream_Record.clear();
+  
+  if (Stream_Buffer.size() >= Stream_Batch*Stream_Fields.size()) WriteHistoryStream();
+  
+}
+
+void COutput::WriteHistoryStream(void) {
+  
+  unsigned long iValue;
+  
+  if ((Stream_Format == NO_STREAM) || Stream_Buffer.empty()) return;
+  
+  if (Stream_Format == STREAM_BINARY) {
+    Stream_File.write(reinterpret_cast<const char *>(&Stream_Buffer[0]), Stream_Buffer.size()*sizeof(passivedouble));
+  } else {
+    
+    /*--- One JSON array per record. Non-finite values (e.g. the log of a zero
+     residual) use the NaN/Infinity literals accepted by the Python reader. ---*/
+    
+    ostringstream lines;
+    lines.precision(17);
+    for (iValue = 0; iValue < Stream_Buffer.size(); iValue++) {
+      passivedouble value = Stream_Buffer[iValue];
+      lines << ((iValue % Stream_Fields.size() == 0) ? "[" : ", ");
+      if (value != value) lines << "NaN";
+      else if (value - value != 0.0) lines << ((value > 0.0) ? "Infinity" : "-Infinity");
+      else lines << value;
+      if ((iValue+1) % Stream_Fields.size() == 0) lines << "]\n";
+    }
+    Stream_File << lines.str();
+    
+  }
+  
+  Stream_File.flush();
+  Stream_Buffer.clear();
+  
+}
+
+void COutput::SetPhase_Time(unsigned short val_phase, su2double val_time) { Phase_Time[val_phase] = val_time; }
+
 void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
                                   CGeometry ***geometry,
                                   CSolver ****solver_container,
@@ -5489,6 +4941,67 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
         
     }
     
+    /*--- Append this iteration to the history stream: the quantities of the
+     history file as raw values with a fixed schema, plus the wall time of
+     each phase of the iteration. ---*/
+    
+    if ((config[val_iZone]->GetKind_History_Stream() != NO_STREAM) && !DualTime_Iteration && (flow || disc_adj)) {
+      
+      const char *Res_Flow_Name[] = {"Res_Flow[0]", "Res_Flow[1]", "Res_Flow[2]", "Res_Flow[3]", "Res_Flow[4]"};
+      const char *Res_Turb_Name[] = {"Res_Turb[0]", "Res_Turb[1]"};
+      const char *Res_AdjFlow_Name[] = {"Res_AdjFlow[0]", "Res_AdjFlow[1]", "Res_AdjFlow[2]", "Res_AdjFlow[3]", "Res_AdjFlow[4]"};
+      const char *Res_AdjTurb_Name[] = {"Res_AdjTurb[0]", "Res_AdjTurb[1]"};
+      
+      AddHistoryStream_Value("Iteration", su2double(iExtIter+ExtIter_OffSet));
+      
+      AddHistoryStream_Value("CLift", Total_CL);      AddHistoryStream_Value("CDrag", Total_CD);
+      AddHistoryStream_Value("CSideForce", Total_CSF); AddHistoryStream_Value("CL/CD", Total_CEff);
+      AddHistoryStream_Value("CMx", Total_CMx);        AddHistoryStream_Value("CMy", Total_CMy);
+      AddHistoryStream_Value("CMz", Total_CMz);        AddHistoryStream_Value("CFx", Total_CFx);
+      AddHistoryStream_Value("CFy", Total_CFy);        AddHistoryStream_Value("CFz", Total_CFz);
+      if (thermal) {
+        AddHistoryStream_Value("HeatFlux_Total", Total_Heat);
+        AddHistoryStream_Value("HeatFlux_Maximum", Total_MaxHeat);
+      }
+      
+      for (iVar = 0; iVar < nVar_Flow; iVar++)
+        AddHistoryStream_Value(Res_Flow_Name[iVar], log10(residual_flow[iVar]));
+      if (turbulent) {
+        for (iVar = 0; iVar < nVar_Turb; iVar++)
+          AddHistoryStream_Value(Res_Turb_Name[iVar], log10(residual_turbulent[iVar]));
+      }
+      
+      if (adjoint) {
+        for (iVar = 0; iVar < nVar_AdjFlow; iVar++)
+          AddHistoryStream_Value(Res_AdjFlow_Name[iVar], log10(residual_adjflow[iVar]));
+        if (turbulent && !config[val_iZone]->GetFrozen_Visc()) {
+          for (iVar = 0; iVar < nVar_AdjTurb; iVar++)
+            AddHistoryStream_Value(Res_AdjTurb_Name[iVar], log10(residual_adjturbulent[iVar]));
+        }
+        AddHistoryStream_Value("Sens_Geo", Total_Sens_Geo);     AddHistoryStream_Value("Sens_Mach", Total_Sens_Mach);
+        AddHistoryStream_Value("Sens_AoA", Total_Sens_AoA);     AddHistoryStream_Value("Sens_Press", Total_Sens_Press);
+        AddHistoryStream_Value("Sens_Temp", Total_Sens_Temp);
+      }
+      
+      if (fiml) {
+        AddHistoryStream_Value("Cp_Diff_Fiml", Total_CpDiff_Fiml);
+        AddHistoryStream_Value("Cl_Diff", Total_ClDiff);  AddHistoryStream_Value("Cl_Diff_Fiml", Total_ClDiff_Fiml);
+        AddHistoryStream_Value("Cd_Diff", Total_CdDiff);  AddHistoryStream_Value("Cd_Diff_Fiml", Total_CdDiff_Fiml);
+      }
+      if (config[val_iZone]->GetTrainNN()) AddHistoryStream_Value("Loss", Total_NN_Loss);
+      
+      AddHistoryStream_Value("Linear_Solver_Iterations", su2double(LinSolvIter));
+      AddHistoryStream_Value("CFL_Number", config[val_iZone]->GetCFL(MESH_0));
+      AddHistoryStream_Value("Time_Total", timeused);
+      AddHistoryStream_Value("Time_Preprocessing", Phase_Time[0]);
+      AddHistoryStream_Value("Time_Solver", Phase_Time[1]);
+      AddHistoryStream_Value("Time_Output", Phase_Time[2]);
+      AddHistoryStream_Value("Time_Communication", Phase_Time[3]);
+      
+      SetHistoryStream_Record(config[val_iZone]);
+      
+    }
+    
     /*--- Header frequency ---*/
     
     bool Unsteady = ((config[val_iZone]->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
@@ -7959,6 +7472,11 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
   
   for (iZone = 0; iZone < val_nZone; iZone++) {
     
+    /*--- The previous files may still be written in the background, from
+     the merged data that is about to be replaced. ---*/
+    
+    WaitResult_Files();
+    
     /*--- Flags identifying the types of files to be written. ---*/
     
     bool Wrt_Vol = config[iZone]->GetWrt_Vol_Sol();
@@ -7996,6 +7514,18 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
     
     unsigned short FileFormat = config[iZone]->GetOutput_FileFormat();
     
+    /*--- Paraview binary and XDMF files are written by all ranks from the
+     linearly partitioned data (see below), hence there is no merging in the
+     master and they are also available when running in parallel. ---*/
+    
+    bool Wrt_Vol_Par = false, Wrt_Srf_Par = false;
+    if ((FileFormat == PARAVIEW_BINARY) || (FileFormat == XDMF)) {
+      Wrt_Vol_Par = config[iZone]->GetWrt_Vol_Sol();
+      Wrt_Srf_Par = config[iZone]->GetWrt_Srf_Sol();
+      Wrt_Vol = false;
+      Wrt_Srf = false;
+    }
+    
     /*--- Merge the node coordinates and connectivity, if necessary. This
      is only performed if a volume solution file is requested, and it
      is active by default. ---*/
@@ -8031,109 +7561,102 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
     
     /*--- Write restart, or Tecplot files using the merged data.
      This data lives only on the master, and these routines are currently
-     executed by the master proc alone (as if in serial). ---*/
+     executed by the master proc alone (as if in serial). With asynchronous
+     output the merged data is handed over to a background thread, which
+     writes the files while the solver keeps iterating; it is released once
+     the thread is joined, before the next merge. ---*/
     
     if (rank == MASTER_NODE) {
       
-      /*--- Write a native restart file ---*/
+      /*--- Only the writers that take nothing but the staged data from the
+       problem definition can run in the background. ---*/
       
-      if (rank == MASTER_NODE) cout << "Writing SU2 native restart file." << endl;
-      SetRestart(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0] , iZone);
+      bool Async = (config[iZone]->GetAsync_Output() &&
+                    ((FileFormat == TECPLOT) || (FileFormat == PARAVIEW) || (!Wrt_Vol && !Wrt_Srf)));
       
-      if (Wrt_Vol) {
-        
-        switch (FileFormat) {
-            
-          case TECPLOT:
-            
-            /*--- Write a Tecplot ASCII file ---*/
-            
-            if (rank == MASTER_NODE) cout << "Writing Tecplot ASCII file volume solution file." << endl;
-            SetTecplotASCII(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone, val_nZone, false);
-            DeallocateConnectivity(config[iZone], geometry[iZone][MESH_0], false);
-            break;
-            
-          case FIELDVIEW:
-            
-            /*--- Write a FieldView ASCII file ---*/
-            
-            if (rank == MASTER_NODE) cout << "Writing FieldView ASCII file volume solution file." << endl;
-            SetFieldViewASCII(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone);
-            DeallocateConnectivity(config[iZone], geometry[iZone][MESH_0], false);
-            break;
-            
-          case TECPLOT_BINARY:
-            
-            /*--- Write a Tecplot binary solution file ---*/
-            
-            if (rank == MASTER_NODE) cout << "Writing Tecplot binary volume solution file." << endl;
-            SetTecplotBinary_DomainSolution(config[iZone], geometry[iZone][MESH_0], iZone);
-            break;
-            
-          case FIELDVIEW_BINARY:
-            
-            /*--- Write a FieldView binary file ---*/
-            
-            if (rank == MASTER_NODE) cout << "Writing FieldView binary file volume solution file." << endl;
-            SetFieldViewBinary(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone);
-            DeallocateConnectivity(config[iZone], geometry[iZone][MESH_0], false);
-            break;
-            
-          case PARAVIEW:
-            
-            /*--- Write a Paraview ASCII file ---*/
-            
-            if (rank == MASTER_NODE) cout << "Writing Paraview ASCII volume solution file." << endl;
-            SetParaview_ASCII(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, false);
-            DeallocateConnectivity(config[iZone], geometry[iZone][MESH_0], false);
-            break;
-            
-          default:
-            break;
+      StageResult_Files(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0],
+                        iZone, val_nZone, Wrt_Vol, Wrt_Srf, Async);
+      
+      if (Async) {
+        cout << "Writing the solution files in the background." << endl;
+        Output_Thread_Active = true;
+        if (pthread_create(&Output_Thread, NULL, Output_Thread_Routine, this) != 0) {
+          Output_Thread_Active = false;
+          Staged_Async = false;
         }
-        
       }
       
-      if (Wrt_Srf) {
+      if (!Output_Thread_Active) {
+        WriteStaged_Files();
+        DeallocateStaged_Files();
+      }
+      
+    }
+    
+    /*--- Binary restart files are written by all ranks at once with MPI-IO,
+     and so are the Paraview binary (one piece per rank) and XDMF files,
+     starting from the linearly partitioned data (no merging in the master). ---*/
+    
+    if (config[iZone]->GetWrt_Binary_Restart() || Wrt_Vol_Par || Wrt_Srf_Par) {
+      
+      switch (config[iZone]->GetKind_Solver()) {
+        case EULER : case NAVIER_STOKES: case RANS :
+          LoadLocalData_Flow(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+          break;
+        case ADJ_EULER : case ADJ_NAVIER_STOKES : case ADJ_RANS :
+        case DISC_ADJ_EULER: case DISC_ADJ_NAVIER_STOKES: case DISC_ADJ_RANS:
+          LoadLocalData_AdjFlow(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+          break;
+        case FEM_ELASTICITY:
+          LoadLocalData_Elasticity(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+          break;
+        case POISSON_EQUATION: case WAVE_EQUATION: case HEAT_EQUATION:
+          LoadLocalData_Base(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+          break;
+        default: break;
+      }
+      
+      SortOutputData(config[iZone], geometry[iZone][MESH_0]);
+      
+      if (config[iZone]->GetWrt_Binary_Restart()) {
+        if (rank == MASTER_NODE) cout << "Writing SU2 binary restart file." << endl;
+        SetRestart_Parallel_Binary(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+      }
+      
+      if (Wrt_Vol_Par || Wrt_Srf_Par) {
         
-        switch (FileFormat) {
-            
-          case TECPLOT:
-            
-            /*--- Write a Tecplot ASCII file ---*/
-            
-            if (rank == MASTER_NODE) cout << "Writing Tecplot ASCII surface solution file." << endl;
-            SetTecplotASCII(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0] , iZone, val_nZone, true);
-            DeallocateConnectivity(config[iZone], geometry[iZone][MESH_0], true);
-            break;
-            
-          case TECPLOT_BINARY:
-            
-            /*--- Write a Tecplot binary solution file ---*/
-            
-            if (rank == MASTER_NODE) cout << "Writing Tecplot binary surface solution file." << endl;
-            SetTecplotBinary_SurfaceSolution(config[iZone], geometry[iZone][MESH_0], iZone);
-            break;
-            
-          case PARAVIEW:
-            
-            /*--- Write a Paraview ASCII file ---*/
-            
-            if (rank == MASTER_NODE) cout << "Writing Paraview ASCII surface solution file." << endl;
-            SetParaview_ASCII(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, true);
-            DeallocateConnectivity(config[iZone], geometry[iZone][MESH_0], true);
-            break;
-            
-          default:
-            break;
+        SortConnectivity(config[iZone], geometry[iZone][MESH_0], iZone);
+        if (Wrt_Srf_Par) SortOutputData_Surface(config[iZone], geometry[iZone][MESH_0]);
+        if (Wrt_Vol_Par && config[iZone]->GetOutput_Filter()) FilterOutputData(config[iZone], geometry[iZone][MESH_0]);
+        
+        if (Wrt_Vol_Par) {
+          if (FileFormat == XDMF) {
+            if (rank == MASTER_NODE) cout << "Writing XDMF volume solution file." << endl;
+            SetXDMF_Parallel(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, false);
+          } else {
+            if (rank == MASTER_NODE) cout << "Writing Paraview binary volume solution file." << endl;
+            SetParaview_Binary_Parallel(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, false);
+          }
+        }
+        
+        if (Wrt_Srf_Par) {
+          if (FileFormat == XDMF) {
+            if (rank == MASTER_NODE) cout << "Writing XDMF surface solution file." << endl;
+            SetXDMF_Parallel(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, true);
+          } else {
+            if (rank == MASTER_NODE) cout << "Writing Paraview binary surface solution file." << endl;
+            SetParaview_Binary_Parallel(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, true);
+          }
+          DeallocateSurfaceData_Parallel(config[iZone], geometry[iZone][MESH_0]);
         }
         
+        DeallocateConnectivity_Parallel(config[iZone], geometry[iZone][MESH_0], false);
+        DeallocateConnectivity_Parallel(config[iZone], geometry[iZone][MESH_0], true);
+        
       }
       
-      /*--- Release memory needed for merging the solution data. ---*/
-      
-      DeallocateCoordinates(config[iZone], geometry[iZone][MESH_0]);
-      DeallocateSolution(config[iZone], geometry[iZone][MESH_0]);
+      DeallocateData_Parallel(config[iZone], geometry[iZone][MESH_0]);
+      Variable_Names.clear();
       
     }
     
@@ -8148,70 +7671,243 @@ void COutput::SetResult_Files(CSolver ****solver_container, CGeometry ***geometr
   }
 }
 
-void COutput::SetBaselineResult_Files(CSolver **solver, CGeometry **geometry, CConfig **config,
-                                      unsigned long iExtIter, unsigned short val_nZone) {
+void COutput::StageResult_Files(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone,
+                                unsigned short val_nZone, bool Wrt_Vol, bool Wrt_Srf, bool val_async) {
   
-  int rank = MASTER_NODE;
-  int size = SINGLE_NODE;
+  ostringstream metadata;
+  bool adjoint = config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint();
+  bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+                    (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   
-#ifdef HAVE_MPI
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  MPI_Comm_size(MPI_COMM_WORLD, &size);
-#endif
+  Staged_Config   = config;
+  Staged_Geometry = geometry;
+  Staged_Solver   = solver;
+  Staged_iZone    = val_iZone;
+  Staged_nZone    = val_nZone;
+  Staged_Vol      = Wrt_Vol;
+  Staged_Srf      = Wrt_Srf;
+  Staged_Async    = val_async;
+  
+  /*--- The flow conditions and the iteration counter change while the
+   solver iterates, copy those written at the end of the restart file. ---*/
+  
+  metadata.precision(15);
+  metadata << scientific;
+  metadata <<"AOA= " << config->GetAoA() - config->GetAoA_Offset() << endl;
+  metadata <<"SIDESLIP_ANGLE= " << config->GetAoS() - config->GetAoS_Offset() << endl;
+  metadata <<"INITIAL_BCTHRUST= " << config->GetInitial_BCThrust() << endl;
+  metadata <<"DCD_DCL_VALUE= " << config->GetdCD_dCL() << endl;
+  if (adjoint) metadata << "SENS_AOA=" << solver[ADJFLOW_SOL]->GetTotal_Sens_AoA() * PI_NUMBER / 180.0 << endl;
+  if (dual_time)
+    metadata <<"EXT_ITER= " << config->GetExtIter() + 1 << endl;
+  else
+    metadata <<"EXT_ITER= " << config->GetExtIter() + config->GetExtIter_OffSet() + 1 << endl;
   
-  unsigned short iZone;
+  Restart_Metadata = metadata.str();
   
-  for (iZone = 0; iZone < val_nZone; iZone++) {
-    
-    /*--- Flags identifying the types of files to be written. ---*/
-    
-    bool Low_MemoryOutput = config[iZone]->GetLow_MemoryOutput();
-    bool Wrt_Vol = config[iZone]->GetWrt_Vol_Sol();
-    bool Wrt_Srf = config[iZone]->GetWrt_Srf_Sol();
-    
-    /*--- Get the file output format ---*/
-    
-    unsigned short FileFormat = config[iZone]->GetOutput_FileFormat();
-    
-    /*--- Merge the node coordinates and connectivity if necessary. This
-     is only performed if a volume solution file is requested, and it
-     is active by default. ---*/
-    
-    if ((Wrt_Vol || Wrt_Srf) && (!Low_MemoryOutput)) {
-      if (rank == MASTER_NODE) cout << "Merging connectivities in the Master node." << endl;
-      MergeConnectivity(config[iZone], geometry[iZone], iZone);
-    }
+}
+
+void COutput::WriteStaged_Files(void) {
+  
+  unsigned short FileFormat = Staged_Config->GetOutput_FileFormat();
     
-    /*--- Merge the solution data needed for volume solutions and restarts ---*/
+    /*--- Write a native restart file (ASCII, the binary one is written
+     by all ranks in SetResult_Files) ---*/
     
-    if ((Wrt_Vol || Wrt_Srf) && (!Low_MemoryOutput)) {
-      if (rank == MASTER_NODE) cout << "Merging solution in the Master node." << endl;
-      MergeBaselineSolution(config[iZone], geometry[iZone], solver[iZone], iZone);
+    if (!Staged_Config->GetWrt_Binary_Restart()) {
+      if (!Staged_Async) cout << "Writing SU2 native restart file." << endl;
+      SetRestart(Staged_Config, Staged_Geometry, Staged_Solver, Staged_iZone);
     }
     
-    /*--- Write restart, Tecplot or Paraview files using the merged data.
-     This data lives only on the master, and these routines are currently
-     executed by the master proc alone (as if in serial). ---*/
-    
-    if (!Low_MemoryOutput) {
+    if (Staged_Vol) {
       
-      if (rank == MASTER_NODE) {
-        
-        if (Wrt_Vol) {
+      switch (FileFormat) {
           
-          switch (FileFormat) {
-              
-            case TECPLOT:
-              
-              /*--- Write a Tecplot ASCII file ---*/
-              
-              if (rank == MASTER_NODE) cout << "Writing Tecplot ASCII file (volume grid)." << endl;
-              SetTecplotASCII(config[iZone], geometry[iZone], solver, iZone, val_nZone, false);
-              DeallocateConnectivity(config[iZone], geometry[iZone], false);
-              break;
-              
-            case FIELDVIEW:
-              
+        case TECPLOT:
+          
+          /*--- Write a Tecplot ASCII file ---*/
+          
+          if (!Staged_Async) cout << "Writing Tecplot ASCII file volume solution file." << endl;
+          SetTecplotASCII(Staged_Config, Staged_Geometry, Staged_Solver, Staged_iZone, Staged_nZone, false);
+          break;
+          
+        case FIELDVIEW:
+          
+          /*--- Write a FieldView ASCII file ---*/
+          
+          if (!Staged_Async) cout << "Writing FieldView ASCII file volume solution file." << endl;
+          SetFieldViewASCII(Staged_Config, Staged_Geometry, Staged_iZone, Staged_nZone);
+          break;
+          
+        case TECPLOT_BINARY:
+          
+          /*--- Write a Tecplot binary solution file ---*/
+          
+          if (!Staged_Async) cout << "Writing Tecplot binary volume solution file." << endl;
+          SetTecplotBinary_DomainSolution(Staged_Config, Staged_Geometry, Staged_iZone);
+          break;
+          
+        case FIELDVIEW_BINARY:
+          
+          /*--- Write a FieldView binary file ---*/
+          
+          if (!Staged_Async) cout << "Writing FieldView binary file volume solution file." << endl;
+          SetFieldViewBinary(Staged_Config, Staged_Geometry, Staged_iZone, Staged_nZone);
+          break;
+          
+        case PARAVIEW:
+          
+          /*--- Write a Paraview ASCII file ---*/
+          
+          if (!Staged_Async) cout << "Writing Paraview ASCII volume solution file." << endl;
+          SetParaview_ASCII(Staged_Config, Staged_Geometry, Staged_iZone, Staged_nZone, false);
+          break;
+          
+        default:
+          break;
+      }
+      
+    }
+    
+    if (Staged_Srf) {
+      
+      switch (FileFormat) {
+          
+        case TECPLOT:
+          
+          /*--- Write a Tecplot ASCII file ---*/
+          
+          if (!Staged_Async) cout << "Writing Tecplot ASCII surface solution file." << endl;
+          SetTecplotASCII(Staged_Config, Staged_Geometry, Staged_Solver, Staged_iZone, Staged_nZone, true);
+          break;
+          
+        case TECPLOT_BINARY:
+          
+          /*--- Write a Tecplot binary solution file ---*/
+          
+          if (!Staged_Async) cout << "Writing Tecplot binary surface solution file." << endl;
+          SetTecplotBinary_SurfaceSolution(Staged_Config, Staged_Geometry, Staged_iZone);
+          break;
+          
+        case PARAVIEW:
+          
+          /*--- Write a Paraview ASCII file ---*/
+          
+          if (!Staged_Async) cout << "Writing Paraview ASCII surface solution file." << endl;
+          SetParaview_ASCII(Staged_Config, Staged_Geometry, Staged_iZone, Staged_nZone, true);
+          break;
+          
+        default:
+          break;
+      }
+      
+    }
+  
+}
+
+void COutput::DeallocateStaged_Files(void) {
+  
+  unsigned short FileFormat = Staged_Config->GetOutput_FileFormat();
+  
+  /*--- Connectivity (the Tecplot binary one is released after writing the mesh) ---*/
+  
+  if (Staged_Vol && ((FileFormat == TECPLOT) || (FileFormat == FIELDVIEW) ||
+                     (FileFormat == FIELDVIEW_BINARY) || (FileFormat == PARAVIEW)))
+    DeallocateConnectivity(Staged_Config, Staged_Geometry, false);
+  
+  if (Staged_Srf && ((FileFormat == TECPLOT) || (FileFormat == PARAVIEW)))
+    DeallocateConnectivity(Staged_Config, Staged_Geometry, true);
+  
+  /*--- Release memory needed for merging the solution data. ---*/
+  
+  DeallocateCoordinates(Staged_Config, Staged_Geometry);
+  DeallocateSolution(Staged_Config, Staged_Geometry);
+  
+}
+
+void COutput::WaitResult_Files(void) {
+  
+  if (!Output_Thread_Active) return;
+  
+  pthread_join(Output_Thread, NULL);
+  Output_Thread_Active = false;
+  
+  DeallocateStaged_Files();
+  
+}
+
+void *COutput::Output_Thread_Routine(void *output) {
+  
+  ((COutput *)output)->WriteStaged_Files();
+  
+  return NULL;
+  
+}
+
+void COutput::SetBaselineResult_Files(CSolver **solver, CGeometry **geometry, CConfig **config,
+                                      unsigned long iExtIter, unsigned short val_nZone) {
+  
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  
+  unsigned short iZone;
+  
+  for (iZone = 0; iZone < val_nZone; iZone++) {
+    
+    /*--- Flags identifying the types of files to be written. ---*/
+    
+    bool Low_MemoryOutput = config[iZone]->GetLow_MemoryOutput();
+    bool Wrt_Vol = config[iZone]->GetWrt_Vol_Sol();
+    bool Wrt_Srf = config[iZone]->GetWrt_Srf_Sol();
+    
+    /*--- Get the file output format ---*/
+    
+    unsigned short FileFormat = config[iZone]->GetOutput_FileFormat();
+    
+    /*--- Merge the node coordinates and connectivity if necessary. This
+     is only performed if a volume solution file is requested, and it
+     is active by default. ---*/
+    
+    if ((Wrt_Vol || Wrt_Srf) && (!Low_MemoryOutput)) {
+      if (rank == MASTER_NODE) cout << "Merging connectivities in the Master node." << endl;
+      MergeConnectivity(config[iZone], geometry[iZone], iZone);
+    }
+    
+    /*--- Merge the solution data needed for volume solutions and restarts ---*/
+    
+    if ((Wrt_Vol || Wrt_Srf) && (!Low_MemoryOutput)) {
+      if (rank == MASTER_NODE) cout << "Merging solution in the Master node." << endl;
+      MergeBaselineSolution(config[iZone], geometry[iZone], solver[iZone], iZone);
+    }
+    
+    /*--- Write restart, Tecplot or Paraview files using the merged data.
+     This data lives only on the master, and these routines are currently
+     executed by the master proc alone (as if in serial). ---*/
+    
+    if (!Low_MemoryOutput) {
+      
+      if (rank == MASTER_NODE) {
+        
+        if (Wrt_Vol) {
+          
+          switch (FileFormat) {
+              
+            case TECPLOT:
+              
+              /*--- Write a Tecplot ASCII file ---*/
+              
+              if (rank == MASTER_NODE) cout << "Writing Tecplot ASCII file (volume grid)." << endl;
+              SetTecplotASCII(config[iZone], geometry[iZone], solver, iZone, val_nZone, false);
+              DeallocateConnectivity(config[iZone], geometry[iZone], false);
+              break;
+              
+            case FIELDVIEW:
+              
               /*--- Write a FieldView ASCII file ---*/
               
               if (rank == MASTER_NODE) cout << "Writing FieldView ASCII file (volume grid)." << endl;
@@ -8412,9 +8108,12 @@ void COutput::SetMesh_Files(CGeometry **geometry, CConfig **config, unsigned sho
       
       if (rank == MASTER_NODE) cout <<"Writing .su2 file." << endl;
       
-      /*--- Write a .su2 ASCII file ---*/
+      /*--- Write a .su2 ASCII or binary file ---*/
       
-      if (su2_file) SetSU2_MeshASCII(config[iZone], geometry[iZone]);
+      if (su2_file) {
+        if (config[iZone]->GetMesh_Out_FileFormat() == SU2_BINARY) SetSU2_MeshBinary(config[iZone], geometry[iZone]);
+        else SetSU2_MeshASCII(config[iZone], geometry[iZone]);
+      }
       
       /*--- Deallocate connectivity ---*/
       
@@ -11021,17 +10720,72 @@ void COutput::SetResult_Files_Parallel(CSolver ****solver_container,
       cout << "Sorting output data across all ranks." << endl;
     SortOutputData(config[iZone], geometry[iZone][MESH_0]);
     
-    /*--- Write parallel ASCII restart files. This will be replaced with
-     a binary alternative with MPI-IO soon. ---*/
+    /*--- Write parallel ASCII restart files, or the binary alternative
+     with MPI-IO. ---*/
     
-    if (rank == MASTER_NODE)
-      cout << "Writing SU2 native restart file." << endl;
-    SetRestart_Parallel(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+    if (config[iZone]->GetWrt_Binary_Restart()) {
+      if (rank == MASTER_NODE)
+        cout << "Writing SU2 binary restart file." << endl;
+      SetRestart_Parallel_Binary(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+    } else {
+      if (rank == MASTER_NODE)
+        cout << "Writing SU2 native restart file." << endl;
+      SetRestart_Parallel(config[iZone], geometry[iZone][MESH_0], solver_container[iZone][MESH_0], iZone);
+    }
     
     /*--- Get the file output format ---*/
     
     unsigned short FileFormat = config[iZone]->GetOutput_FileFormat();
     
+    /*--- The Paraview binary and XDMF writers are fully parallel, enable them. ---*/
+    
+    if ((FileFormat == PARAVIEW_BINARY) || (FileFormat == XDMF)) {
+      Wrt_Vol = config[iZone]->GetWrt_Vol_Sol();
+      Wrt_Srf = config[iZone]->GetWrt_Srf_Sol();
+    }
+    
+    /*--- If requested, write Paraview binary (one piece per rank) or XDMF
+     solution files in parallel. ---*/
+    
+    if ((Wrt_Vol || Wrt_Srf) && ((FileFormat == PARAVIEW_BINARY) || (FileFormat == XDMF))) {
+      
+      if (rank == MASTER_NODE)
+        cout << "Preparing element connectivity across all ranks." << endl;
+      SortConnectivity(config[iZone], geometry[iZone][MESH_0], iZone);
+      
+      if (Wrt_Srf) SortOutputData_Surface(config[iZone], geometry[iZone][MESH_0]);
+      
+      /*--- Remove the points that did not pass the output filters (after the
+       surface data, which is extracted from the complete volume data). ---*/
+      
+      if (Wrt_Vol && config[iZone]->GetOutput_Filter()) FilterOutputData(config[iZone], geometry[iZone][MESH_0]);
+      
+      if (Wrt_Vol) {
+        if (FileFormat == XDMF) {
+          if (rank == MASTER_NODE) cout << "Writing XDMF volume solution file." << endl;
+          SetXDMF_Parallel(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, false);
+        } else {
+          if (rank == MASTER_NODE) cout << "Writing Paraview binary volume solution file." << endl;
+          SetParaview_Binary_Parallel(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, false);
+        }
+      }
+      
+      if (Wrt_Srf) {
+        if (FileFormat == XDMF) {
+          if (rank == MASTER_NODE) cout << "Writing XDMF surface solution file." << endl;
+          SetXDMF_Parallel(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, true);
+        } else {
+          if (rank == MASTER_NODE) cout << "Writing Paraview binary surface solution file." << endl;
+          SetParaview_Binary_Parallel(config[iZone], geometry[iZone][MESH_0], iZone, val_nZone, true);
+        }
+        DeallocateSurfaceData_Parallel(config[iZone], geometry[iZone][MESH_0]);
+      }
+      
+      DeallocateConnectivity_Parallel(config[iZone], geometry[iZone][MESH_0], false);
+      DeallocateConnectivity_Parallel(config[iZone], geometry[iZone][MESH_0], true);
+      
+    }
+    
     /*--- If requested, write Tecplot ASCII solution files in parallel. ---*/
     
     if ((Wrt_Vol || Wrt_Srf) && (FileFormat == TECPLOT)) {
@@ -11046,6 +10800,10 @@ void COutput::SetResult_Files_Parallel(CSolver ****solver_container,
       
       SortOutputData_Surface(config[iZone], geometry[iZone][MESH_0]);
       
+      /*--- Remove the points that did not pass the output filters. ---*/
+      
+      if (Wrt_Vol && config[iZone]->GetOutput_Filter()) FilterOutputData(config[iZone], geometry[iZone][MESH_0]);
+      
       /*--- Write Tecplot ASCII files for the volume and/or surface solutions. ---*/
       
       if (Wrt_Vol) {
@@ -11310,6 +11068,13 @@ void COutput::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSolver *
       nVar_Par += 1;
       Variable_Names.push_back("Eddy_Viscosity");
       
+      /*--- Add the per-point fields registered by the turbulence solver. ---*/
+      
+      for (jVar = 0; jVar < solver[TURB_SOL]->GetnOutputFields(); jVar++) {
+        nVar_Par += 1;
+        Variable_Names.push_back(solver[TURB_SOL]->GetOutputField_Name(jVar));
+      }
+      
     }
     
     /*--- Add the distance to the nearest sharp edge if requested. ---*/
@@ -11528,6 +11293,9 @@ void COutput::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSolver *
         
         if (Kind_Solver == RANS) {
           Local_Data[jPoint][iVar] = solver[FLOW_SOL]->node[iPoint]->GetEddyViscosity(); iVar++;
+          for (jVar = 0; jVar < solver[TURB_SOL]->GetnOutputFields(); jVar++) {
+            Local_Data[jPoint][iVar] = solver[TURB_SOL]->GetOutputField(jVar, iPoint); iVar++;
+          }
         }
         
         /*--- Load data for the distance to the nearest sharp edge. ---*/
@@ -12573,6 +12341,17 @@ void COutput::SortVolumetricConnectivity(CConfig *config, CGeometry *geometry, u
       exit(EXIT_FAILURE); break;
   }
   
+  /*--- When the output filters are active, skip the elements that have a
+   node that did not pass them (flags set when sorting the output data). ---*/
+  
+  vector<bool> Keep_Elem(geometry->GetnElem(), true);
+  if (Local_Filter != NULL) {
+    for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+      for (unsigned short iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++)
+        if (!Local_Filter[geometry->elem[iElem]->GetNode(iNode)]) Keep_Elem[iElem] = false;
+    }
+  }
+  
   /*--- Force the removal of all added periodic elements (use global index).
    First, we isolate and create a list of all added periodic points, excluding
    those that were part of the original domain (we want these to be in the
@@ -12773,7 +12552,7 @@ void COutput::SortVolumetricConnectivity(CConfig *config, CGeometry *geometry, u
   nElem_Send[size] = 0; nElem_Recv[size] = 0;
   
   for (int ii = 0; ii < (int)geometry->GetnElem(); ii++ ) {
-    if (geometry->elem[ii]->GetVTK_Type() == Elem_Type) {
+    if ((geometry->elem[ii]->GetVTK_Type() == Elem_Type) && Keep_Elem[ii]) {
       for ( int jj = 0; jj < NODES_PER_ELEMENT; jj++ ) {
         
         /*--- Get the index of the current point. ---*/
@@ -12867,7 +12646,7 @@ void COutput::SortVolumetricConnectivity(CConfig *config, CGeometry *geometry, u
    additional data that we will send to the other procs. ---*/
   
   for (int ii = 0; ii < (int)geometry->GetnElem(); ii++) {
-    if (geometry->elem[ii]->GetVTK_Type() == Elem_Type) {
+    if ((geometry->elem[ii]->GetVTK_Type() == Elem_Type) && Keep_Elem[ii]) {
       for ( int jj = 0; jj < NODES_PER_ELEMENT; jj++ ) {
         
         /*--- Get the index of the current point. ---*/
@@ -13716,6 +13495,7 @@ void COutput::SortOutputData(CConfig *config, CGeometry *geometry) {
   int *Local_Halo = NULL;
 
   bool isPeriodic;
+  bool filter = config->GetOutput_Filter();
   
   int rank = MASTER_NODE;
   int size = SINGLE_NODE;
@@ -13750,6 +13530,15 @@ void COutput::SortOutputData(CConfig *config, CGeometry *geometry) {
     }
   }
   
+  /*--- Flag the points that pass the output filters. The flag travels with
+   the data as an extra column, so that the restart files remain complete and
+   the volume files can drop the other points after the sorting. ---*/
+  
+  if (filter) {
+    SetOutput_Filter(config, geometry);
+    VARS_PER_POINT = nVar_Par+1;
+  }
+  
   /*--- Sum total number of nodes that belong to the domain ---*/
   
   nLocalPoint = 0;
@@ -13930,9 +13719,12 @@ void COutput::SortOutputData(CConfig *config, CGeometry *geometry) {
         
         /*--- Load the data values. ---*/
         
-        for (unsigned short kk = 0; kk < VARS_PER_POINT; kk++) {
+        for (unsigned short kk = 0; kk < nVar_Par; kk++) {
           connSend[nn] = Local_Data[iPoint][kk]; nn++;
         }
+        if (filter) {
+          connSend[nn] = (Local_Filter[iPoint] ? 1.0 : 0.0); nn++;
+        }
         
         /*--- Load the global ID (minus offset) for sorting the
          points once they all reach the correct processor. ---*/
@@ -14071,14 +13863,21 @@ void COutput::SortOutputData(CConfig *config, CGeometry *geometry) {
    structure before post-processing below. First, allocate the
    appropriate amount of memory for this section. ---*/
   
-  Parallel_Data = new su2double*[VARS_PER_POINT];
-  for (int jj = 0; jj < VARS_PER_POINT; jj++) {
+  Parallel_Data = new su2double*[nVar_Par];
+  for (int jj = 0; jj < nVar_Par; jj++) {
     Parallel_Data[jj] = new su2double[nPoint_Recv[size]];
     for (int ii = 0; ii < nPoint_Recv[size]; ii++) {
       Parallel_Data[jj][idRecv[ii]] = connRecv[ii*VARS_PER_POINT+jj];
     }
   }
   
+  if (filter) {
+    Parallel_Filter = new bool[nPoint_Recv[size]];
+    for (int ii = 0; ii < nPoint_Recv[size]; ii++) {
+      Parallel_Filter[idRecv[ii]] = (connRecv[ii*VARS_PER_POINT+nVar_Par] > 0.5);
+    }
+  }
+  
   /*--- Store the total number of local points my rank has for
    the current section after completing the communications. ---*/
   
@@ -14115,6 +13914,257 @@ void COutput::SortOutputData(CConfig *config, CGeometry *geometry) {
   
 }
 
+void COutput::SetOutput_Filter(CConfig *config, CGeometry *geometry) {
+  
+  unsigned short iDim, iMarker, iMarker_Filter;
+  unsigned long iPoint, iVertex;
+  
+  unsigned short nDim = geometry->GetnDim();
+  unsigned long Stride = config->GetOutput_Filter_Stride();
+  unsigned short nMarker_Filter = config->GetnMarker_Output_Filter();
+  su2double *Box = config->GetOutput_Filter_Box();
+  su2double *WallDist = config->GetOutput_Filter_WallDist();
+  su2double Distance;
+  
+  if (Local_Filter != NULL) delete [] Local_Filter;
+  Local_Filter = new bool[geometry->GetnPoint()];
+  
+  /*--- Box, wall distance band and stride (by global index, so that the
+   decimation does not depend on the partitioning). ---*/
+  
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    
+    Local_Filter[iPoint] = ((geometry->node[iPoint]->GetGlobalIndex() % Stride) == 0);
+    
+    for (iDim = 0; iDim < nDim; iDim++) {
+      if ((geometry->node[iPoint]->GetCoord(iDim) < Box[iDim]) ||
+          (geometry->node[iPoint]->GetCoord(iDim) > Box[iDim+3]))
+        Local_Filter[iPoint] = false;
+    }
+    
+    Distance = geometry->node[iPoint]->GetWall_Distance();
+    if ((Distance < WallDist[0]) || (Distance > WallDist[1]))
+      Local_Filter[iPoint] = false;
+    
+  }
+  
+  /*--- Marker list: keep only the points that lie on one of the markers. ---*/
+  
+  if (nMarker_Filter != 0) {
+    
+    bool *On_Marker = new bool[geometry->GetnPoint()];
+    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+      On_Marker[iPoint] = false;
+    
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      for (iMarker_Filter = 0; iMarker_Filter < nMarker_Filter; iMarker_Filter++) {
+        if (config->GetMarker_All_TagBound(iMarker) == config->GetMarker_Output_Filter(iMarker_Filter)) {
+          for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
+            On_Marker[geometry->vertex[iMarker][iVertex]->GetNode()] = true;
+        }
+      }
+    }
+    
+    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+      if (!On_Marker[iPoint]) Local_Filter[iPoint] = false;
+    
+    delete [] On_Marker;
+    
+  }
+  
+}
+
+void COutput::FilterOutputData(CConfig *config, CGeometry *geometry) {
+  
+  unsigned short iVar, iType, iNode;
+  unsigned long iPoint, jPoint, iElem, jElem, Global_Index, nKeep = 0;
+  int iProcessor;
+  
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  
+  if (Parallel_Filter == NULL) return;
+  
+  /*--- Offsets of each rank in the linear partitioning of the points,
+   before and after removing the points that did not pass the filters. ---*/
+  
+  for (iPoint = 0; iPoint < nParallel_Poin; iPoint++)
+    if (Parallel_Filter[iPoint]) nKeep++;
+  
+  unsigned long *nPoint_Linear = new unsigned long[size+1];
+  unsigned long *nKeep_Linear  = new unsigned long[size+1];
+  nPoint_Linear[0] = 0; nKeep_Linear[0] = 0;
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(&nParallel_Poin, 1, MPI_UNSIGNED_LONG, &nPoint_Linear[1], 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(&nKeep, 1, MPI_UNSIGNED_LONG, &nKeep_Linear[1], 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#else
+  nPoint_Linear[1] = nParallel_Poin;
+  nKeep_Linear[1]  = nKeep;
+#endif
+  
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    nPoint_Linear[iProcessor+1] += nPoint_Linear[iProcessor];
+    nKeep_Linear[iProcessor+1]  += nKeep_Linear[iProcessor];
+  }
+  
+  /*--- Compact the data of the points that we keep and store their new
+   global index (-1 for the removed points). ---*/
+  
+  long *New_Index = new long[nParallel_Poin];
+  
+  jPoint = 0;
+  for (iPoint = 0; iPoint < nParallel_Poin; iPoint++) {
+    if (Parallel_Filter[iPoint]) {
+      New_Index[iPoint] = nKeep_Linear[rank] + jPoint;
+      for (iVar = 0; iVar < nVar_Par; iVar++)
+        Parallel_Data[iVar][jPoint] = Parallel_Data[iVar][iPoint];
+      jPoint++;
+    } else {
+      New_Index[iPoint] = -1;
+    }
+  }
+  
+  /*--- The volume connectivity references the old global indices (starting
+   at 1), which may be owned by any rank. Ask the owners for the new ones. ---*/
+  
+  int **Conn_Type = new int*[6];
+  unsigned long *nElem_Type = new unsigned long[6];
+  unsigned short *nNode_Type = new unsigned short[6];
+  
+  Conn_Type[0] = Conn_Tria_Par; nElem_Type[0] = nParallel_Tria; nNode_Type[0] = N_POINTS_TRIANGLE;
+  Conn_Type[1] = Conn_Quad_Par; nElem_Type[1] = nParallel_Quad; nNode_Type[1] = N_POINTS_QUADRILATERAL;
+  Conn_Type[2] = Conn_Tetr_Par; nElem_Type[2] = nParallel_Tetr; nNode_Type[2] = N_POINTS_TETRAHEDRON;
+  Conn_Type[3] = Conn_Hexa_Par; nElem_Type[3] = nParallel_Hexa; nNode_Type[3] = N_POINTS_HEXAHEDRON;
+  Conn_Type[4] = Conn_Pris_Par; nElem_Type[4] = nParallel_Pris; nNode_Type[4] = N_POINTS_PRISM;
+  Conn_Type[5] = Conn_Pyra_Par; nElem_Type[5] = nParallel_Pyra; nNode_Type[5] = N_POINTS_PYRAMID;
+  
+  int *nId_Send = new int[size+1];
+  int *nId_Recv = new int[size+1];
+  int *Id_Index = new int[size];
+  for (iProcessor = 0; iProcessor <= size; iProcessor++) {
+    nId_Send[iProcessor] = 0; nId_Recv[iProcessor] = 0;
+  }
+  
+  for (iType = 0; iType < 6; iType++) {
+    for (iElem = 0; iElem < nElem_Type[iType]*nNode_Type[iType]; iElem++) {
+      Global_Index = Conn_Type[iType][iElem]-1;
+      iProcessor = upper_bound(nPoint_Linear, nPoint_Linear+size+1, Global_Index) - nPoint_Linear - 1;
+      nId_Send[iProcessor+1]++;
+    }
+  }
+  
+#ifdef HAVE_MPI
+  MPI_Alltoall(&(nId_Send[1]), 1, MPI_INT, &(nId_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+#else
+  nId_Recv[1] = nId_Send[1];
+#endif
+  
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    nId_Send[iProcessor+1] += nId_Send[iProcessor];
+    nId_Recv[iProcessor+1] += nId_Recv[iProcessor];
+  }
+  
+  unsigned long *idSend = new unsigned long[nId_Send[size]];
+  unsigned long *idRecv = new unsigned long[nId_Recv[size]];
+  long *newSend = new long[nId_Send[size]];
+  long *newRecv = new long[nId_Recv[size]];
+  
+  for (iProcessor = 0; iProcessor < size; iProcessor++) Id_Index[iProcessor] = nId_Send[iProcessor];
+  for (iType = 0; iType < 6; iType++) {
+    for (iElem = 0; iElem < nElem_Type[iType]*nNode_Type[iType]; iElem++) {
+      Global_Index = Conn_Type[iType][iElem]-1;
+      iProcessor = upper_bound(nPoint_Linear, nPoint_Linear+size+1, Global_Index) - nPoint_Linear - 1;
+      idSend[Id_Index[iProcessor]] = Global_Index - nPoint_Linear[iProcessor];
+      Id_Index[iProcessor]++;
+    }
+  }
+  
+#ifdef HAVE_MPI
+  int *nId_SendCount = new int[size];
+  int *nId_RecvCount = new int[size];
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    nId_SendCount[iProcessor] = nId_Send[iProcessor+1] - nId_Send[iProcessor];
+    nId_RecvCount[iProcessor] = nId_Recv[iProcessor+1] - nId_Recv[iProcessor];
+  }
+  MPI_Alltoallv(idSend, nId_SendCount, nId_Send, MPI_UNSIGNED_LONG,
+                idRecv, nId_RecvCount, nId_Recv, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#else
+  for (int ii = 0; ii < nId_Send[size]; ii++) idRecv[ii] = idSend[ii];
+#endif
+  
+  for (int ii = 0; ii < nId_Recv[size]; ii++) newRecv[ii] = New_Index[idRecv[ii]];
+  
+#ifdef HAVE_MPI
+  MPI_Alltoallv(newRecv, nId_RecvCount, nId_Recv, MPI_LONG,
+                newSend, nId_SendCount, nId_Send, MPI_LONG, MPI_COMM_WORLD);
+  delete [] nId_SendCount;
+  delete [] nId_RecvCount;
+#else
+  for (int ii = 0; ii < nId_Recv[size]; ii++) newSend[ii] = newRecv[ii];
+#endif
+  
+  /*--- Renumber the connectivity in the same order as the requests, and drop
+   any element that still references a removed point. ---*/
+  
+  for (iProcessor = 0; iProcessor < size; iProcessor++) Id_Index[iProcessor] = nId_Send[iProcessor];
+  for (iType = 0; iType < 6; iType++) {
+    jElem = 0;
+    for (iElem = 0; iElem < nElem_Type[iType]; iElem++) {
+      bool Keep_Elem = true;
+      for (iNode = 0; iNode < nNode_Type[iType]; iNode++) {
+        Global_Index = Conn_Type[iType][iElem*nNode_Type[iType]+iNode]-1;
+        iProcessor = upper_bound(nPoint_Linear, nPoint_Linear+size+1, Global_Index) - nPoint_Linear - 1;
+        long New_Global = newSend[Id_Index[iProcessor]];
+        Id_Index[iProcessor]++;
+        if (New_Global < 0) Keep_Elem = false;
+        Conn_Type[iType][jElem*nNode_Type[iType]+iNode] = (int)(New_Global+1);
+      }
+      if (Keep_Elem) jElem++;
+    }
+    nElem_Type[iType] = jElem;
+  }
+  
+  nParallel_Tria = nElem_Type[0]; nParallel_Quad = nElem_Type[1]; nParallel_Tetr = nElem_Type[2];
+  nParallel_Hexa = nElem_Type[3]; nParallel_Pris = nElem_Type[4]; nParallel_Pyra = nElem_Type[5];
+  
+  /*--- Update the local and global number of points and elements of the volume files. ---*/
+  
+  nParallel_Poin = nKeep;
+  nGlobal_Poin_Par = nKeep_Linear[size];
+  
+  unsigned long nTotal_Elem = nParallel_Tria + nParallel_Quad + nParallel_Tetr + nParallel_Hexa + nParallel_Pris + nParallel_Pyra;
+#ifndef HAVE_MPI
+  nGlobal_Elem_Par = nTotal_Elem;
+#else
+  SU2_MPI::Allreduce(&nTotal_Elem, &nGlobal_Elem_Par, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  
+  if (rank == MASTER_NODE)
+    cout << "Output filters: writing " << nGlobal_Poin_Par << " points and " << nGlobal_Elem_Par << " elements of the volume." << endl;
+  
+  /*--- Free temporary memory ---*/
+  
+  delete [] Conn_Type;
+  delete [] nElem_Type;
+  delete [] nNode_Type;
+  delete [] nId_Send;
+  delete [] nId_Recv;
+  delete [] Id_Index;
+  delete [] idSend;
+  delete [] idRecv;
+  delete [] newSend;
+  delete [] newRecv;
+  delete [] New_Index;
+  delete [] nPoint_Linear;
+  delete [] nKeep_Linear;
+  
+}
+
 void COutput::SortOutputData_Surface(CConfig *config, CGeometry *geometry) {
   
   unsigned short iMarker;
@@ -15650,6 +15700,154 @@ void COutput::SetRestart_Parallel(CConfig *config, CGeometry *geometry, CSolver
   
 }
 
+void COutput::SetRestart_Parallel_Binary(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone) {
+  
+  /*--- Local variables ---*/
+  
+  unsigned short nZone = geometry->GetnZone();
+  unsigned short iVar;
+  unsigned long iPoint, iExtIter = config->GetExtIter();
+  bool fem       = (config->GetKind_Solver() == FEM_ELASTICITY);
+  bool adjoint   = (config->GetContinuous_Adjoint() ||
+                    config->GetDiscrete_Adjoint());
+  bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+                    (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
+  string filename;
+  
+  int iProcessor;
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  
+  /*--- Retrieve filename from config ---*/
+  
+  if ((config->GetContinuous_Adjoint()) || (config->GetDiscrete_Adjoint())) {
+    filename = config->GetRestart_AdjFileName();
+    filename = config->GetObjFunc_Extension(filename);
+  } else if (fem) {
+    filename = config->GetRestart_FEMFileName();
+  } else {
+    filename = config->GetRestart_FlowFileName();
+  }
+  
+  /*--- Append the zone number if multizone problems ---*/
+  if (nZone > 1)
+    filename= config->GetMultizone_FileName(filename, val_iZone);
+  
+  /*--- Unsteady problems require an iteration number to be appended. ---*/
+  if (config->GetUnsteady_Simulation() == HARMONIC_BALANCE) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(val_iZone));
+  } else if (config->GetWrt_Unsteady()) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
+  } else if ((fem) && (config->GetWrt_Dynamic())) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
+  }
+  
+  /*--- After the sorting, each rank holds a contiguous range of global
+   indices. Only write original domain points, i.e., exclude any periodic
+   or halo nodes (the last ones), even if they are output in the viz. files. ---*/
+  
+  unsigned long *nPoint_Rank = new unsigned long[size];
+  unsigned long offset = 0, nPoint_Restart = 0;
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(&nParallel_Poin, 1, MPI_UNSIGNED_LONG, nPoint_Rank, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#else
+  nPoint_Rank[MASTER_NODE] = nParallel_Poin;
+#endif
+  
+  for (iProcessor = 0; iProcessor < rank; iProcessor++) offset += nPoint_Rank[iProcessor];
+  for (iPoint = 0; iPoint < nParallel_Poin; iPoint++)
+    if (iPoint + offset < geometry->GetGlobal_nPointDomain()) nPoint_Restart++;
+  
+  delete [] nPoint_Rank;
+  
+  /*--- Pack the local records (fixed width, nVar_Par values per point). ---*/
+  
+  passivedouble *buf = new passivedouble[nPoint_Restart*nVar_Par];
+  for (iPoint = 0; iPoint < nPoint_Restart; iPoint++)
+    for (iVar = 0; iVar < nVar_Par; iVar++)
+      buf[iPoint*nVar_Par+iVar] = SU2_TYPE::GetValue(Parallel_Data[iVar][iPoint]);
+  
+  /*--- The general header and flow conditions are kept as text after the
+   solution records, so that they are parsed as in the ASCII format. ---*/
+  
+  ostringstream metadata;
+  metadata.precision(15);
+  metadata << scientific;
+  metadata <<"AOA= " << config->GetAoA() - config->GetAoA_Offset() << endl;
+  metadata <<"SIDESLIP_ANGLE= " << config->GetAoS() - config->GetAoS_Offset() << endl;
+  metadata <<"INITIAL_BCTHRUST= " << config->GetInitial_BCThrust() << endl;
+  metadata <<"DCD_DCL_VALUE= " << config->GetdCD_dCL() << endl;
+  if (adjoint) metadata << "SENS_AOA=" << solver[ADJFLOW_SOL]->GetTotal_Sens_AoA() * PI_NUMBER / 180.0 << endl;
+  if (dual_time)
+    metadata <<"EXT_ITER= " << config->GetExtIter() + 1 << endl;
+  else
+    metadata <<"EXT_ITER= " << config->GetExtIter() + config->GetExtIter_OffSet() + 1 << endl;
+  string metadata_text = metadata.str();
+  
+  /*--- Header: identifier, number of variables, number of points and length
+   of the metadata, followed by the variable names (fixed length). ---*/
+  
+  int var_buf[5] = {SU2_BINARY_RESTART, (int)nVar_Par, (int)geometry->GetGlobal_nPointDomain(), (int)metadata_text.size(), 0};
+  char *name_buf = new char[nVar_Par*CGNS_STRING_SIZE];
+  for (iVar = 0; iVar < nVar_Par; iVar++) {
+    strncpy(&name_buf[iVar*CGNS_STRING_SIZE], Variable_Names[iVar].c_str(), CGNS_STRING_SIZE);
+    name_buf[(iVar+1)*CGNS_STRING_SIZE-1] = '\0';
+  }
+  
+  unsigned long header_size = 5*sizeof(int) + nVar_Par*CGNS_STRING_SIZE*sizeof(char);
+  unsigned long record_size = nVar_Par*sizeof(passivedouble);
+  
+#ifdef HAVE_MPI
+  
+  /*--- All ranks open the file, the master writes the header and the
+   metadata, and the records are written with a single collective call. ---*/
+  
+  MPI_File fhw;
+  MPI_Status status;
+  MPI_Offset disp;
+  
+  int ierr = MPI_File_open(MPI_COMM_WORLD, (char *)filename.c_str(), MPI_MODE_CREATE|MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw);
+  if (ierr != MPI_SUCCESS) {
+    if (rank == MASTER_NODE)
+      cout << "Unable to open SU2 restart file " << filename << "." << endl;
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+  }
+  MPI_File_set_size(fhw, 0);
+  
+  if (rank == MASTER_NODE) {
+    MPI_File_write_at(fhw, 0, var_buf, 5, MPI_INT, &status);
+    MPI_File_write_at(fhw, 5*sizeof(int), name_buf, nVar_Par*CGNS_STRING_SIZE, MPI_CHAR, &status);
+    disp = header_size + geometry->GetGlobal_nPointDomain()*record_size;
+    MPI_File_write_at(fhw, disp, (char *)metadata_text.c_str(), metadata_text.size(), MPI_CHAR, &status);
+  }
+  
+  disp = header_size + offset*record_size;
+  MPI_File_write_at_all(fhw, disp, buf, nPoint_Restart*nVar_Par, MPI_DOUBLE, &status);
+  
+  MPI_File_close(&fhw);
+  
+#else
+  
+  ofstream restart_file(filename.c_str(), ios::out | ios::binary);
+  restart_file.write((char *)var_buf, 5*sizeof(int));
+  restart_file.write(name_buf, nVar_Par*CGNS_STRING_SIZE);
+  restart_file.write((char *)buf, nPoint_Restart*record_size);
+  restart_file.write(metadata_text.c_str(), metadata_text.size());
+  restart_file.close();
+  
+#endif
+  
+  delete [] buf;
+  delete [] name_buf;
+  
+}
+
 void COutput::DeallocateConnectivity_Parallel(CConfig *config, CGeometry *geometry, bool surf_sol) {
   
   /*--- Deallocate memory for connectivity data on each processor. ---*/
@@ -15661,6 +15859,11 @@ void COutput::DeallocateConnectivity_Parallel(CConfig *config, CGeometry *geomet
       delete [] Conn_BoundTria_Par;
     if (nParallel_BoundQuad > 0 && Conn_BoundQuad_Par != NULL)
       delete [] Conn_BoundQuad_Par;
+    
+    /*--- Reset, the output may be sorted again at the next write. ---*/
+    
+    Conn_Line_Par = NULL; Conn_BoundTria_Par = NULL; Conn_BoundQuad_Par = NULL;
+    nParallel_Line = 0; nParallel_BoundTria = 0; nParallel_BoundQuad = 0;
   }
   else {
     if (nParallel_Tria > 0 && Conn_Tria_Par != NULL) delete [] Conn_Tria_Par;
@@ -15669,6 +15872,11 @@ void COutput::DeallocateConnectivity_Parallel(CConfig *config, CGeometry *geomet
     if (Conn_Hexa_Par != NULL) delete [] Conn_Hexa_Par;
     if (Conn_Pris_Par != NULL) delete [] Conn_Pris_Par;
     if (Conn_Pyra_Par != NULL) delete [] Conn_Pyra_Par;
+    
+    Conn_Tria_Par = NULL; Conn_Quad_Par = NULL; Conn_Tetr_Par = NULL;
+    Conn_Hexa_Par = NULL; Conn_Pris_Par = NULL; Conn_Pyra_Par = NULL;
+    nParallel_Tria = 0; nParallel_Quad = 0; nParallel_Tetr = 0;
+    nParallel_Hexa = 0; nParallel_Pris = 0; nParallel_Pyra = 0;
   }
   
 }
@@ -15681,6 +15889,13 @@ void COutput::DeallocateData_Parallel(CConfig *config, CGeometry *geometry) {
     if (Parallel_Data[iVar] != NULL) delete [] Parallel_Data[iVar];
   }
   if (Parallel_Data != NULL) delete [] Parallel_Data;
+  Parallel_Data = NULL;
+  
+  /*--- Deallocate memory for the output filter flags ---*/
+  
+  if (Local_Filter != NULL) delete [] Local_Filter;
+  if (Parallel_Filter != NULL) delete [] Parallel_Filter;
+  Local_Filter = NULL; Parallel_Filter = NULL;
   
 }
 
@@ -15692,5 +15907,6 @@ void COutput::DeallocateSurfaceData_Parallel(CConfig *config, CGeometry *geometr
     if (Parallel_Surf_Data[iVar] != NULL) delete [] Parallel_Surf_Data[iVar];
   }
   if (Parallel_Surf_Data != NULL) delete [] Parallel_Surf_Data;
+  Parallel_Surf_Data = NULL;
   
 }
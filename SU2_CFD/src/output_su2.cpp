@@ -242,4 +242,200 @@ void COutput::SetSU2_MeshASCII(CConfig *config, CGeometry *geometry) {
   
 }
 
-void COutput::SetSU2_MeshBinary(CConfig *config, CGeometry *geometry) { }
+void COutput::SetSU2_MeshBinary(CConfig *config, CGeometry *geometry) {
+  
+  unsigned long iElem, iPoint, iElem_Bound, nElem_Bound_, iNode, nElem, nConn, vnode;
+  unsigned short iMarker, iDim, nDim = geometry->GetnDim(), iChar, iPeriodic, nPeriodic = 0, iType, nMarker_ = 0;
+  su2double *center, *angles, *transl;
+  ofstream output_file;
+  ifstream input_file;
+  string text_line, Marker_Tag;
+  string::size_type position;
+  
+  /*--- The binary file stores a fixed size header (identifier, dimension,
+   number of markers and periodic transformations, element, connectivity
+   and point counts, AoA/AoS offsets) followed by the element types, the
+   zero-based connectivity, the interleaved coordinates and, at the end,
+   the markers and the periodic transformations. The volume data sits at
+   known offsets, so each rank can read its own slice of it in parallel. ---*/
+  
+  int header_int[4];
+  unsigned long header_long[4];
+  passivedouble header_double[2];
+  
+  /*--- Write the volume elements in the same order as the ASCII format. ---*/
+  
+  unsigned long nGlobal_Elem[6] = {nGlobal_Tria, nGlobal_Quad, nGlobal_Tetr, nGlobal_Hexa, nGlobal_Pris, nGlobal_Pyra};
+  int *Conn_Elem[6] = {Conn_Tria, Conn_Quad, Conn_Tetr, Conn_Hexa, Conn_Pris, Conn_Pyra};
+  int VTK_Elem[6] = {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+  unsigned short nNode_Elem[6] = {N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+    N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+  
+  nElem = 0; nConn = 0;
+  for (iType = 0; iType < 6; iType++) {
+    nElem += nGlobal_Elem[iType];
+    nConn += nGlobal_Elem[iType]*nNode_Elem[iType];
+  }
+  
+  /*--- Read the boundary information written by the geometry preprocessing. ---*/
+  
+  vector<string> Marker_Tags;
+  vector<vector<int> > Marker_Types;
+  vector<vector<unsigned long> > Marker_Conn;
+  
+  input_file.open("boundary.su2", ios::in);
+  
+  while (getline (input_file, text_line)) {
+    
+    position = text_line.find ("NMARK=",0);
+    if (position != string::npos) {
+      
+      text_line.erase (0,6); nMarker_ = atoi(text_line.c_str());
+      Marker_Tags.resize(nMarker_); Marker_Types.resize(nMarker_); Marker_Conn.resize(nMarker_);
+      
+      for (iMarker = 0 ; iMarker < nMarker_; iMarker++) {
+        
+        getline (input_file, text_line);
+        text_line.erase (0,11);
+        for (iChar = 0; iChar < 20; iChar++) {
+          position = text_line.find( " ", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+          position = text_line.find( "\r", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+          position = text_line.find( "\n", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+        }
+        Marker_Tag = text_line.c_str();
+        
+        /*--- Send-receive boundaries only exist in pre-partitioned meshes. ---*/
+        
+        if ((Marker_Tag == "SEND_RECEIVE") || (Marker_Tag.size() >= (unsigned long)CGNS_STRING_SIZE)) {
+          cout << "Marker " << Marker_Tag << " can not be written to a binary mesh file!" << endl;
+#ifndef HAVE_MPI
+          exit(EXIT_FAILURE);
+#else
+          MPI_Abort(MPI_COMM_WORLD,1);
+          MPI_Finalize();
+#endif
+        }
+        Marker_Tags[iMarker] = Marker_Tag;
+        
+        getline (input_file, text_line);
+        text_line.erase (0,13); nElem_Bound_ = atoi(text_line.c_str());
+        
+        for (iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+          
+          getline(input_file, text_line);
+          istringstream bound_line(text_line);
+          
+          int VTK_Type; bound_line >> VTK_Type;
+          Marker_Types[iMarker].push_back(VTK_Type);
+          
+          unsigned short nNodes = 0;
+          switch(VTK_Type) {
+            case LINE:          nNodes = N_POINTS_LINE; break;
+            case TRIANGLE:      nNodes = N_POINTS_TRIANGLE; break;
+            case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+          }
+          for (iNode = 0; iNode < nNodes; iNode++) {
+            bound_line >> vnode; Marker_Conn[iMarker].push_back(vnode);
+          }
+        }
+      }
+    }
+    
+  }
+  
+  input_file.close();
+  
+  remove("boundary.su2");
+  
+  /*--- Fill the header. ---*/
+  
+  nPeriodic = config->GetnPeriodicIndex();
+  
+  header_int[0] = SU2_BINARY_MESH;
+  header_int[1] = nDim;
+  header_int[2] = nMarker_;
+  header_int[3] = nPeriodic;
+  
+  header_long[0] = nElem;
+  header_long[1] = nConn;
+  header_long[2] = nGlobal_Doma;
+  header_long[3] = nGlobal_Doma;
+  if (geometry->GetGlobal_nPointDomain() != nGlobal_Doma)
+    header_long[3] = geometry->GetGlobal_nPointDomain();
+  
+  header_double[0] = SU2_TYPE::GetValue(config->GetAoA_Offset());
+  header_double[1] = SU2_TYPE::GetValue(config->GetAoS_Offset());
+  
+  output_file.open(config->GetMesh_Out_FileName().c_str(), ios::out | ios::binary);
+  
+  output_file.write((char *)header_int, 4*sizeof(int));
+  output_file.write((char *)header_long, 4*sizeof(unsigned long));
+  output_file.write((char *)header_double, 2*sizeof(passivedouble));
+  
+  /*--- Write the element types and the zero-based connectivity. ---*/
+  
+  for (iType = 0; iType < 6; iType++) {
+    vector<int> Elem_Type(nGlobal_Elem[iType], VTK_Elem[iType]);
+    if (!Elem_Type.empty())
+      output_file.write((char *)&Elem_Type[0], Elem_Type.size()*sizeof(int));
+  }
+  
+  for (iType = 0; iType < 6; iType++) {
+    vector<unsigned long> Elem_Conn(nGlobal_Elem[iType]*nNode_Elem[iType]);
+    for (iNode = 0; iNode < Elem_Conn.size(); iNode++)
+      Elem_Conn[iNode] = Conn_Elem[iType][iNode]-1;
+    if (!Elem_Conn.empty())
+      output_file.write((char *)&Elem_Conn[0], Elem_Conn.size()*sizeof(unsigned long));
+  }
+  
+  /*--- Write the interleaved node coordinates. ---*/
+  
+  passivedouble *Coord_Buffer = new passivedouble[nGlobal_Doma*nDim];
+  for (iPoint = 0; iPoint < nGlobal_Doma; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      Coord_Buffer[iPoint*nDim+iDim] = SU2_TYPE::GetValue(Coords[iDim][iPoint]);
+  output_file.write((char *)Coord_Buffer, nGlobal_Doma*nDim*sizeof(passivedouble));
+  delete [] Coord_Buffer;
+  
+  /*--- Write the markers. ---*/
+  
+  for (iMarker = 0; iMarker < nMarker_; iMarker++) {
+    
+    char str_buf[CGNS_STRING_SIZE];
+    memset(str_buf, 0, CGNS_STRING_SIZE*sizeof(char));
+    strncpy(str_buf, Marker_Tags[iMarker].c_str(), CGNS_STRING_SIZE-1);
+    output_file.write(str_buf, CGNS_STRING_SIZE*sizeof(char));
+    
+    unsigned long marker_long[2] = {Marker_Types[iMarker].size(), Marker_Conn[iMarker].size()};
+    output_file.write((char *)marker_long, 2*sizeof(unsigned long));
+    if (!Marker_Types[iMarker].empty())
+      output_file.write((char *)&Marker_Types[iMarker][0], marker_long[0]*sizeof(int));
+    if (!Marker_Conn[iMarker].empty())
+      output_file.write((char *)&Marker_Conn[iMarker][0], marker_long[1]*sizeof(unsigned long));
+    
+  }
+  
+  /*--- Write the center, rotation and translation of each periodic transformation. ---*/
+  
+  for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+    
+    center = config->GetPeriodicCenter(iPeriodic);
+    angles = config->GetPeriodicRotation(iPeriodic);
+    transl = config->GetPeriodicTranslate(iPeriodic);
+    
+    passivedouble periodic_buf[9];
+    for (iDim = 0; iDim < 3; iDim++) {
+      periodic_buf[iDim]   = SU2_TYPE::GetValue(center[iDim]);
+      periodic_buf[iDim+3] = SU2_TYPE::GetValue(angles[iDim]);
+      periodic_buf[iDim+6] = SU2_TYPE::GetValue(transl[iDim]);
+    }
+    output_file.write((char *)periodic_buf, 9*sizeof(passivedouble));
+    
+  }
+  
+  output_file.close();
+  
+}
@@ -39,7 +39,7 @@ void COutput::SetTecplotASCII(CConfig *config, CGeometry *geometry, CSolver **so
   unsigned short Kind_Solver = config->GetKind_Solver();
   
   unsigned long iPoint, iElem, iNode;
-  unsigned long iExtIter = config->GetExtIter();
+  unsigned long iExtIter = Output_ExtIter;
   unsigned long *LocalIndex = NULL;
   bool *SurfacePoint = NULL;
   
@@ -176,15 +176,8 @@ void COutput::SetTecplotASCII(CConfig *config, CGeometry *geometry, CSolver **so
       
       if (Kind_Solver == RANS) {
         Tecplot_File << ", \"<greek>m</greek><sub>t</sub>\"";
-        if (config->GetKind_Turb_Model() == SA_FIML) {
-        	Tecplot_File << ", \"<greek>b</greek>\", \"Production\", \"Destruction\", \"S<sub>hat</sub>\", \"<greek>X</greek>\", \"<greek>d</greek>\", \"f<sub>w</sub>\", \"r\", \"Strain_Mag\", \"Vort_Mag\", \"wall_dist\", \"f<sub>d</sub>\"";
-        	if (config->GetKind_Trans_Model() == BC) {
-        		Tecplot_File << ", \"<greek>g</greek>\"";
-        	}
-        	if (config->GetTrainNN()) {
-        		Tecplot_File << ", \"<greek>b<sub>TRAIN</sub></greek>\"";
-        	}
-        }
+        for (iVar = 0; iVar < Field_Names.size(); iVar++)
+          Tecplot_File << ", \"" << Field_Names[iVar] << "\"";
       }
       
       if (config->GetWrt_SharpEdges()) {
@@ -49,10 +49,8 @@ CDiscAdjSolver::CDiscAdjSolver(CGeometry *geometry, CConfig *config, CSolver *di
   train_NN = false;
   jrh_debug = false;
   unsigned long iVertex, iPoint, index;
-  string text_line, mesh_filename;
-  ifstream restart_file;
+  string mesh_filename;
   string filename, AdjExt;
-  su2double dull_val;
   bool done_before;
 
   bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
@@ -167,32 +165,14 @@ CDiscAdjSolver::CDiscAdjSolver(CGeometry *geometry, CConfig *config, CSolver *di
     mesh_filename = config->GetSolution_AdjFileName();
     filename = config->GetObjFunc_Extension(mesh_filename);
 
-    restart_file.open(filename.data(), ios::in);
+    /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
 
-    /*--- In case there is no file ---*/
-    if (restart_file.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no adjoint restart file!! " << filename.data() << "."<< endl;
-      exit(EXIT_FAILURE);
-    }
-
-    /*--- In case this is a parallel simulation, we need to perform the
-     Global2Local index transformation first. ---*/
-    
-    map<unsigned long,unsigned long> Global2Local; //Made protected variables of class so they could be accessed below - JRH 05102017
-    map<unsigned long,unsigned long>::const_iterator MI;
-    
-    /*--- Now fill array with the transform values only for local points ---*/
+    Read_SU2_Restart(geometry, config, filename);
 
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
       Local2Global[iPoint] = geometry->node[iPoint]->GetGlobalIndex();
     }
 
-    /*--- Read all lines in the restart file ---*/
-    long iPoint_Local; unsigned long iPoint_Global = 0; unsigned long iPoint_Global_Local = 0;
-    unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
-
     /*--- Skip coordinates ---*/
     unsigned short skipVars = nDim;
 
@@ -206,54 +186,12 @@ CDiscAdjSolver::CDiscAdjSolver(CGeometry *geometry, CConfig *config, CSolver *di
       }
     }
 
-    /*--- The first line is the header ---*/
-    
-    getline (restart_file, text_line);
-    
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPoint(); iPoint_Global++ ) {
-      
-      getline (restart_file, text_line);
-      
-      istringstream point_line(text_line);
-
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
-      
-      MI = Global2Local.find(iPoint_Global);
-      if (MI != Global2Local.end()) {
-        
-        iPoint_Local = Global2Local[iPoint_Global];
-        
-        point_line >> index;
-        for (iVar = 0; iVar < skipVars; iVar++) { point_line >> dull_val;}
-        for (iVar = 0; iVar < nVar; iVar++) { point_line >> Solution[iVar];}
-        node[iPoint_Local] = new CDiscAdjVariable(Solution, nDim, nVar, config);
-        iPoint_Global_Local++;
-      }
-      
-    }
-
+    /*--- Load data from the restart into correct containers. ---*/
 
-    /*--- Detect a wrong solution file ---*/
-    
-    if (iPoint_Global_Local < nPointDomain) { sbuf_NotMatching = 1; }
-#ifndef HAVE_MPI
-    rbuf_NotMatching = sbuf_NotMatching;
-#else
-    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
-#endif
-    if (rbuf_NotMatching != 0) {
-      if (rank == MASTER_NODE) {
-        cout << endl << "The solution file " << filename.data() << " doesn't match with the mesh file!" << endl;
-        cout << "It could be empty lines at the end of the file." << endl << endl;
-      }
-#ifndef HAVE_MPI
-      exit(EXIT_FAILURE);
-#else
-      MPI_Barrier(MPI_COMM_WORLD);
-      MPI_Abort(MPI_COMM_WORLD,1);
-      MPI_Finalize();
-#endif
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      index = iPoint*Restart_Vars + skipVars;
+      for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
+      node[iPoint] = new CDiscAdjVariable(Solution, nDim, nVar, config);
     }
 
     /*--- Instantiate the variable class with an arbitrary solution
@@ -263,8 +201,8 @@ CDiscAdjSolver::CDiscAdjSolver(CGeometry *geometry, CConfig *config, CSolver *di
       node[iPoint] = new CDiscAdjVariable(Solution, nDim, nVar, config);
     }
 
-    /*--- Close the restart file ---*/
-    restart_file.close();
+    /*--- Delete the class memory that is used to load the restart. ---*/
+    Delete_Restart_Data();
 
   }
 
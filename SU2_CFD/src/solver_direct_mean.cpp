@@ -164,7 +164,7 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
   
   unsigned long iPoint, index, counter_local = 0, counter_global = 0, iVertex;
   unsigned short iVar, iDim, iMarker, nLineLets;
-  su2double StaticEnergy, Density, Velocity2, Pressure, Temperature, dull_val;
+  su2double StaticEnergy, Density, Velocity2, Pressure, Temperature;
   int Unst_RestartIter;
   ifstream restart_file;
   unsigned short iZone = config->GetiZone();
@@ -215,33 +215,47 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
       filename_ = config->GetUnsteady_FileName(filename_, Unst_RestartIter);
     }
 
-    /*--- Open the restart file, throw an error if this fails. ---*/
-    
-    restart_file.open(filename_.data(), ios::in);
-    if (restart_file.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no flow restart file!! " << filename_.data() << "."<< endl;
-      exit(EXIT_FAILURE);
-    }
-    
     unsigned long iPoint_Global = 0;
     string text_line;
+    istringstream restart_metadata;
+    istream *restart_stream = &restart_file;
     
-    /*--- The first line is the header (General description) ---*/
-    
-    getline (restart_file, text_line);
-    
-    /*--- Space for the solution ---*/
-    
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+    if (config->GetRead_Binary_Restart()) {
+      
+      /*--- The extra info of a binary restart is stored as text after the
+       solution records, read it directly. ---*/
+      
+      restart_metadata.str(Read_SU2_Restart_Metadata(filename_));
+      restart_stream = &restart_metadata;
+      
+    } else {
+      
+      /*--- Open the restart file, throw an error if this fails. ---*/
+      
+      restart_file.open(filename_.data(), ios::in);
+      if (restart_file.fail()) {
+        if (rank == MASTER_NODE)
+          cout << "There is no flow restart file!! " << filename_.data() << "."<< endl;
+        exit(EXIT_FAILURE);
+      }
+      
+      /*--- The first line is the header (General description) ---*/
       
       getline (restart_file, text_line);
       
+      /*--- Space for the solution ---*/
+      
+      for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+        
+        getline (restart_file, text_line);
+        
+      }
+      
     }
     
     /*--- Space for extra info (if any) ---*/
     
-    while (getline (restart_file, text_line)) {
+    while (getline (*restart_stream, text_line)) {
       
       /*--- Angle of attack ---*/
       
@@ -974,86 +988,17 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
       filename = config->GetUnsteady_FileName(filename, Unst_RestartIter);
     }
 
-        /*--- Open the restart file, throw an error if this fails. ---*/
-    
-    restart_file.open(filename.data(), ios::in);
-    if (restart_file.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no flow restart file!! " << filename.data() << "."<< endl;
-      exit(EXIT_FAILURE);
-    }
-    
-    /*--- In case this is a parallel simulation, we need to perform the
-     Global2Local index transformation first. ---*/
-    
-    map<unsigned long,unsigned long> Global2Local;
-    map<unsigned long,unsigned long>::const_iterator MI;
-    
-    /*--- Now fill array with the transform values only for local points ---*/
-    
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-      Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
-    
-    /*--- Read all lines in the restart file ---*/
-    
-    long iPoint_Local;
-    unsigned long iPoint_Global_Local = 0, iPoint_Global = 0; string text_line;
-    unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
-    
-    /*--- The first line is the header ---*/
-    
-    getline (restart_file, text_line);
-    
-    /*--- Solution ---*/
-    
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      
-      getline (restart_file, text_line);
-      
-      istringstream point_line(text_line);
-      
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
-      
-      MI = Global2Local.find(iPoint_Global);
-      if (MI != Global2Local.end()) {
-      
-      iPoint_Local = Global2Local[iPoint_Global];
-      
-      /*--- Load the solution for this node. Note that the first entry
-       on the restart file line is the global index, followed by the
-       node coordinates, and then the conservative variables. ---*/
-      
-        if (nDim == 2) point_line >> index >> dull_val >> dull_val >> Solution[0] >> Solution[1] >> Solution[2] >> Solution[3];
-        if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1] >> Solution[2] >> Solution[3] >> Solution[4];
-
-        node[iPoint_Local] = new CEulerVariable(Solution, nDim, nVar, config);
-        iPoint_Global_Local++;
-      }
-
-    }
+    /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
     
-    /*--- Detect a wrong solution file ---*/
+    Read_SU2_Restart(geometry, config, filename);
     
-    if (iPoint_Global_Local < nPointDomain) { sbuf_NotMatching = 1; }
+    /*--- Load the solution for each node. Note that the fields of each
+     point are the node coordinates, and then the conservative variables. ---*/
     
-#ifndef HAVE_MPI
-    rbuf_NotMatching = sbuf_NotMatching;
-#else
-    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
-#endif
-    if (rbuf_NotMatching != 0) {
-      if (rank == MASTER_NODE) {
-        cout << endl << "The solution file " << filename.data() << " doesn't match with the mesh file!" << endl;
-        cout << "It could be empty lines at the end of the file." << endl << endl;
-      }
-#ifndef HAVE_MPI
-      exit(EXIT_FAILURE);
-#else
-      MPI_Barrier(MPI_COMM_WORLD);
-      MPI_Abort(MPI_COMM_WORLD,1);
-      MPI_Finalize();
-#endif
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      index = iPoint*Restart_Vars + nDim;
+      for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
+      node[iPoint] = new CEulerVariable(Solution, nDim, nVar, config);
     }
     
     /*--- Instantiate the variable class with an arbitrary solution
@@ -1063,9 +1008,9 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
     for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
       node[iPoint] = new CEulerVariable(Solution, nDim, nVar, config);
     
-    /*--- Close the restart file ---*/
+    /*--- Delete the class memory that is used to load the restart. ---*/
     
-    restart_file.close();
+    Delete_Restart_Data();
     
   }
   
@@ -6493,42 +6438,42 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 }
 
 void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config) {
-  unsigned long iPoint, jPoint, iEdge, iVertex;
-  unsigned short iDim, iVar, iMarker;
-  su2double *PrimVar_Vertex, *PrimVar_i, *PrimVar_j, PrimVar_Average,
+  unsigned long iPoint, jPoint, iEdge, iEdgeColor, iVertex;
+  unsigned short iDim, iVar, iMarker, iColor;
+  su2double *PrimVar_Vertex, PrimVar_Average,
   Partial_Gradient, Partial_Res, *Normal;
   
   /*--- Gradient primitive variables compressible (temp, vx, vy, vz, P, rho) ---*/
 
   PrimVar_Vertex = new su2double [nPrimVarGrad];
-  PrimVar_i = new su2double [nPrimVarGrad];
-  PrimVar_j = new su2double [nPrimVarGrad];
   
   /*--- Set Gradient_Primitive to zero ---*/
   
   for (iPoint = 0; iPoint < nPointDomain; iPoint++)
     node[iPoint]->SetGradient_PrimitiveZero(nPrimVarGrad);
 
-  /*--- Loop interior edges ---*/
+  /*--- Loop interior edges, color by color (the edges of a color do not
+   share points, so they can be split among threads) ---*/
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      PrimVar_i[iVar] = node[iPoint]->GetPrimitive(iVar);
-      PrimVar_j[iVar] = node[jPoint]->GetPrimitive(iVar);
-    }
-    
-    Normal = geometry->edge[iEdge]->GetNormal();
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      PrimVar_Average =  0.5 * ( PrimVar_i[iVar] + PrimVar_j[iVar] );
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Partial_Res = PrimVar_Average*Normal[iDim];
-        if (geometry->node[iPoint]->GetDomain())
-          node[iPoint]->AddGradient_Primitive(iVar, iDim, Partial_Res);
-        if (geometry->node[jPoint]->GetDomain())
-          node[jPoint]->SubtractGradient_Primitive(iVar, iDim, Partial_Res);
+  for (iColor = 0; iColor < geometry->GetnEdgeColor(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iEdge, iPoint, jPoint, iVar, iDim, PrimVar_Average, Partial_Res, Normal)
+#endif
+    for (iEdgeColor = 0; iEdgeColor < geometry->GetnEdge_Color(iColor); iEdgeColor++) {
+      iEdge = geometry->GetEdge_Color(iColor, iEdgeColor);
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      
+      Normal = geometry->edge[iEdge]->GetNormal();
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        PrimVar_Average =  0.5 * ( node[iPoint]->GetPrimitive(iVar) + node[jPoint]->GetPrimitive(iVar) );
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Partial_Res = PrimVar_Average*Normal[iDim];
+          if (geometry->node[iPoint]->GetDomain())
+            node[iPoint]->AddGradient_Primitive(iVar, iDim, Partial_Res);
+          if (geometry->node[jPoint]->GetDomain())
+            node[jPoint]->SubtractGradient_Primitive(iVar, iDim, Partial_Res);
+        }
       }
     }
   }
@@ -6566,8 +6511,6 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
   }
 
   delete [] PrimVar_Vertex;
-  delete [] PrimVar_i;
-  delete [] PrimVar_j;
 
   Set_MPI_Primitive_Gradient(geometry, config);
 
@@ -14429,14 +14372,13 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
   unsigned short iDim, iVar, iMesh, iMeshFine;
   unsigned long iPoint, index, iChildren, Point_Fine;
   unsigned short turb_model = config->GetKind_Turb_Model();
-  su2double Area_Children, Area_Parent, *Coord, *Solution_Fine, dull_val;
+  su2double Area_Children, Area_Parent, *Coord, *Solution_Fine;
   bool grid_movement  = config->GetGrid_Movement();
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   bool steady_restart = config->GetSteadyRestart();
   bool time_stepping = config->GetUnsteady_Simulation() == TIME_STEPPING;
-  string UnstExt, text_line;
-  ifstream restart_file;
+  string UnstExt;
   
   unsigned short iZone = config->GetiZone();
   unsigned short nZone = geometry[iZone]->GetnZone();
@@ -14447,11 +14389,6 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
   for (iDim = 0; iDim < nDim; iDim++)
     Coord[iDim] = 0.0;
   
-  int rank = MASTER_NODE;
-#ifdef HAVE_MPI
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-#endif
-  
   /*--- Multizone problems require the number of the zone to be appended. ---*/
 
   if (nZone > 1)
@@ -14462,93 +14399,57 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
   if (dual_time || time_stepping)
     restart_filename = config->GetUnsteady_FileName(restart_filename, val_iter);
   
-  /*--- Open the restart file, and throw an error if this fails. ---*/
-  
-  restart_file.open(restart_filename.data(), ios::in);
-  if (restart_file.fail()) {
-    if (rank == MASTER_NODE)
-      cout << "There is no flow restart file!! " << restart_filename.data() << "."<< endl;
-    exit(EXIT_FAILURE);
-  }
-  
-  /*--- In case this is a parallel simulation, we need to perform the
-   Global2Local index transformation first. ---*/
+  /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
   
-  map<unsigned long,unsigned long> Global2Local;
-  map<unsigned long,unsigned long>::const_iterator MI;
+  Read_SU2_Restart(geometry[MESH_0], config, restart_filename);
   
-  /*--- Now fill array with the transform values only for local points ---*/
+  /*--- Load data from the restart into correct containers. The fields of
+   each point are the coordinates followed by the conservative variables. ---*/
   
   for (iPoint = 0; iPoint < geometry[MESH_0]->GetnPointDomain(); iPoint++) {
-    Global2Local[geometry[MESH_0]->node[iPoint]->GetGlobalIndex()] = iPoint;
-  }
-  
-  /*--- Read all lines in the restart file ---*/
-  
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
-  
-  /*--- The first line is the header ---*/
-  
-  getline (restart_file, text_line);
-  
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++ ) {
     
-    getline (restart_file, text_line);
+    index = iPoint*Restart_Vars;
+    for (iDim = 0; iDim < nDim; iDim++) Coord[iDim] = Restart_Data[index+iDim];
+    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+nDim+iVar];
     
-    istringstream point_line(text_line);
+    node[iPoint]->SetSolution(Solution);
     
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    /*--- For dynamic meshes, read in and store the
+     grid coordinates and grid velocities for each node. ---*/
     
-    MI = Global2Local.find(iPoint_Global);
-    if (MI != Global2Local.end()) {
+    if (grid_movement) {
       
-      iPoint_Local = Global2Local[iPoint_Global];
+      /*--- First, skip any variables for the turbulence model that
+       appear in the restart file before the grid velocities. ---*/
       
-      if (nDim == 2) point_line >> index >> Coord[0] >> Coord[1] >> Solution[0] >> Solution[1] >> Solution[2] >> Solution[3];
-      if (nDim == 3) point_line >> index >> Coord[0] >> Coord[1] >> Coord[2] >> Solution[0] >> Solution[1] >> Solution[2] >> Solution[3] >> Solution[4];
+      index += nDim+nVar;
+      if (turb_model == SA || turb_model == SA_NEG || turb_model == SA_FIML) {
+        index += 1;
+      } else if (turb_model == SST) {
+        index += 2;
+      }
       
-      node[iPoint_Local]->SetSolution(Solution);
+      /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
+      /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
+      /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
       
-      /*--- For dynamic meshes, read in and store the
-       grid coordinates and grid velocities for each node. ---*/
+      su2double GridVel[3] = {0.0,0.0,0.0};
+      if (!steady_restart) {
+        for (iDim = 0; iDim < nDim; iDim++) GridVel[iDim] = Restart_Data[index+iDim];
+      }
       
-      if (grid_movement) {
-        
-        /*--- First, remove any variables for the turbulence model that
-         appear in the restart file before the grid velocities. ---*/
-        
-        if (turb_model == SA || turb_model == SA_NEG || turb_model == SA_FIML) {
-          point_line >> dull_val;
-        } else if (turb_model == SST) {
-          point_line >> dull_val >> dull_val;
-        }
-        
-        /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
-        /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
-        /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
-        
-        su2double GridVel[3] = {0.0,0.0,0.0};
-        if (!steady_restart) {
-            if (nDim == 2) point_line >> GridVel[0] >> GridVel[1];
-            else point_line >> GridVel[0] >> GridVel[1] >> GridVel[2];
-        }
-
-        
-        for (iDim = 0; iDim < nDim; iDim++) {
-          geometry[MESH_0]->node[iPoint_Local]->SetCoord(iDim, Coord[iDim]);
-          geometry[MESH_0]->node[iPoint_Local]->SetGridVel(iDim, GridVel[iDim]);
-        }
-        
+      for (iDim = 0; iDim < nDim; iDim++) {
+        geometry[MESH_0]->node[iPoint]->SetCoord(iDim, Coord[iDim]);
+        geometry[MESH_0]->node[iPoint]->SetGridVel(iDim, GridVel[iDim]);
       }
       
     }
-
+    
   }
   
-  /*--- Close the restart file ---*/
+  /*--- Delete the class memory that is used to load the restart. ---*/
   
-  restart_file.close();
+  Delete_Restart_Data();
   
   /*--- MPI solution ---*/
   
@@ -14646,7 +14547,7 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
   
   unsigned long iPoint, index, counter_local = 0, counter_global = 0, iVertex;
   unsigned short iVar, iDim, iMarker, nLineLets;
-  su2double Density, Velocity2, Pressure, Temperature, dull_val, StaticEnergy;
+  su2double Density, Velocity2, Pressure, Temperature, StaticEnergy;
   int Unst_RestartIter;
   ifstream restart_file;
   unsigned short iZone = config->GetiZone();
@@ -14699,33 +14600,47 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
       filename_ = config->GetUnsteady_FileName(filename_, Unst_RestartIter);
     }
 
-    /*--- Open the restart file, throw an error if this fails. ---*/
-    
-    restart_file.open(filename_.data(), ios::in);
-    if (restart_file.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no flow restart file!! " << filename_.data() << "."<< endl;
-      exit(EXIT_FAILURE);
-    }
-    
     unsigned long iPoint_Global = 0;
     string text_line;
+    istringstream restart_metadata;
+    istream *restart_stream = &restart_file;
     
-    /*--- The first line is the header (General description) ---*/
-    
-    getline (restart_file, text_line);
-    
-    /*--- Space for the solution ---*/
-    
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+    if (config->GetRead_Binary_Restart()) {
+      
+      /*--- The extra info of a binary restart is stored as text after the
+       solution records, read it directly. ---*/
+      
+      restart_metadata.str(Read_SU2_Restart_Metadata(filename_));
+      restart_stream = &restart_metadata;
+      
+    } else {
+      
+      /*--- Open the restart file, throw an error if this fails. ---*/
+      
+      restart_file.open(filename_.data(), ios::in);
+      if (restart_file.fail()) {
+        if (rank == MASTER_NODE)
+          cout << "There is no flow restart file!! " << filename_.data() << "."<< endl;
+        exit(EXIT_FAILURE);
+      }
+      
+      /*--- The first line is the header (General description) ---*/
       
       getline (restart_file, text_line);
       
+      /*--- Space for the solution ---*/
+      
+      for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+        
+        getline (restart_file, text_line);
+        
+      }
+      
     }
     
     /*--- Space for extra info (if any) ---*/
     
-    while (getline (restart_file, text_line)) {
+    while (getline (*restart_stream, text_line)) {
       
       /*--- Angle of attack ---*/
       
@@ -15458,82 +15373,17 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
       filename = config->GetUnsteady_FileName(filename, Unst_RestartIter);
     }
 
-    /*--- Open the restart file, throw an error if this fails. ---*/
-    
-    restart_file.open(filename.data(), ios::in);
-    if (restart_file.fail()) {
-      if (rank == MASTER_NODE)
-        cout << "There is no flow restart file!! " << filename.data() << "."<< endl;
-      exit(EXIT_FAILURE);
-    }
-    
-    /*--- In case this is a parallel simulation, we need to perform the
-     Global2Local index transformation first. ---*/
-    
-    map<unsigned long,unsigned long> Global2Local;
-    map<unsigned long,unsigned long>::const_iterator MI;
-    
-    /*--- Now fill array with the transform values only for local points ---*/
-    
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-      Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
-    
-    /*--- Read all lines in the restart file ---*/
-    
-    long iPoint_Local;
-    unsigned long iPoint_Global_Local = 0, iPoint_Global = 0; string text_line;
-    unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
-    
-    /*--- The first line is the header ---*/
-    
-    getline (restart_file, text_line);
-    
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      
-      getline (restart_file, text_line);
-      
-      istringstream point_line(text_line);
-      
-      if (iPoint_Global >= geometry->GetGlobal_nPointDomain()) { sbuf_NotMatching = 1; break; }
-      
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
-      
-      MI = Global2Local.find(iPoint_Global);
-      if (MI != Global2Local.end()) {
-        
-        iPoint_Local = Global2Local[iPoint_Global];
-        
-        if (nDim == 2) point_line >> index >> dull_val >> dull_val >> Solution[0] >> Solution[1] >> Solution[2] >> Solution[3];
-        if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1] >> Solution[2] >> Solution[3] >> Solution[4];
-
-        node[iPoint_Local] = new CNSVariable(Solution, nDim, nVar, config);
-        iPoint_Global_Local++;
-      }
-
-    }
+    /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
     
-    /*--- Detect a wrong solution file ---*/
+    Read_SU2_Restart(geometry, config, filename);
     
-    if (iPoint_Global_Local < nPointDomain) { sbuf_NotMatching = 1; }
+    /*--- Load the solution for each node. Note that the fields of each
+     point are the node coordinates, and then the conservative variables. ---*/
     
-#ifndef HAVE_MPI
-    rbuf_NotMatching = sbuf_NotMatching;
-#else
-    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
-#endif
-    if (rbuf_NotMatching != 0) {
-      if (rank == MASTER_NODE) {
-        cout << endl << "The solution file " << filename.data() << " doesn't match with the mesh file!" << endl;
-        cout << "It could be empty lines at the end of the file." << endl << endl;
-      }
-#ifndef HAVE_MPI
-      exit(EXIT_FAILURE);
-#else
-      MPI_Barrier(MPI_COMM_WORLD);
-      MPI_Abort(MPI_COMM_WORLD,1);
-      MPI_Finalize();
-#endif
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      index = iPoint*Restart_Vars + nDim;
+      for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
+      node[iPoint] = new CNSVariable(Solution, nDim, nVar, config);
     }
     
     /*--- Instantiate the variable class with an arbitrary solution
@@ -15543,9 +15393,9 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
     for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
       node[iPoint] = new CNSVariable(Solution, nDim, nVar, config);
     
-    /*--- Close the restart file ---*/
+    /*--- Delete the class memory that is used to load the restart. ---*/
     
-    restart_file.close();
+    Delete_Restart_Data();
     
   }
   
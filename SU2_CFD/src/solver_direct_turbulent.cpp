@@ -1055,51 +1055,25 @@ void CTurbSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
   
   unsigned short iVar, iMesh;
   unsigned long iPoint, index, iChildren, Point_Fine;
-  su2double dull_val, Area_Children, Area_Parent, *Solution_Fine;
+  su2double Area_Children, Area_Parent, *Solution_Fine;
   bool compressible   = (config->GetKind_Regime() == COMPRESSIBLE);
   bool incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   bool time_stepping = (config->GetUnsteady_Simulation() == TIME_STEPPING);
-  string UnstExt, text_line;
-  ifstream restart_file;
+  string UnstExt;
   string restart_filename = config->GetSolution_FlowFileName();
-  int rank = MASTER_NODE;
-#ifdef HAVE_MPI
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-#endif
 
   /*--- Modify file name for an unsteady restart ---*/
   
   if (dual_time|| time_stepping)
     restart_filename = config->GetUnsteady_FileName(restart_filename, val_iter);
 
-  /*--- Open the restart file, throw an error if this fails. ---*/
-  
-  restart_file.open(restart_filename.data(), ios::in);
-  if (restart_file.fail()) {
-    if (rank == MASTER_NODE)
-      cout << "There is no flow restart file!! " << restart_filename.data() << "."<< endl;
-    exit(EXIT_FAILURE);
-  }
-
-  /*--- In case this is a parallel simulation, we need to perform the
-   Global2Local index transformation first. ---*/
-  
-  map<unsigned long,unsigned long> Global2Local;
-  map<unsigned long,unsigned long>::const_iterator MI;
-
-  /*--- Now fill array with the transform values only for local points ---*/
-  
-  for (iPoint = 0; iPoint < geometry[MESH_0]->GetnPointDomain(); iPoint++) {
-    Global2Local[geometry[MESH_0]->node[iPoint]->GetGlobalIndex()] = iPoint;
-  }
-
-  /*--- Read all lines in the restart file ---*/
+  /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
   
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
+  Read_SU2_Restart(geometry[MESH_0], config, restart_filename);
 
-  /*--- Skip flow variables ---*/
+  /*--- Skip coordinates and flow variables ---*/
   
   unsigned short skipVars = 0;
 
@@ -1112,36 +1086,17 @@ void CTurbSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
     if (nDim == 3) skipVars += 7;
   }
 
-  /*--- The first line is the header ---*/
+  /*--- Load data from the restart into correct containers. ---*/
   
-  getline (restart_file, text_line);
-
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-    
-    getline (restart_file, text_line);
-    
-    istringstream point_line(text_line);
-
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
-    
-    MI = Global2Local.find(iPoint_Global);
-    if (MI != Global2Local.end()) {
-      
-      iPoint_Local = Global2Local[iPoint_Global];
-      
-      point_line >> index;
-      for (iVar = 0; iVar < skipVars; iVar++) { point_line >> dull_val;}
-      for (iVar = 0; iVar < nVar; iVar++) { point_line >> Solution[iVar];}
-      node[iPoint_Local]->SetSolution(Solution);
-
-    }
-
+  for (iPoint = 0; iPoint < geometry[MESH_0]->GetnPointDomain(); iPoint++) {
+    index = iPoint*Restart_Vars + skipVars;
+    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
+    node[iPoint]->SetSolution(Solution);
   }
 
-  /*--- Close the restart file ---*/
+  /*--- Delete the class memory that is used to load the restart. ---*/
   
-  restart_file.close();
+  Delete_Restart_Data();
 
   /*--- MPI solution and compute the eddy viscosity ---*/
   
@@ -1281,6 +1236,28 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
       OutputHeadingNames = new string[nOutputVariables];
     }
     
+    /*--- Register the FIML correction and the features of the model
+     (and the training target) as per-point output fields. ---*/
+    
+    if (config->GetKind_Turb_Model() == SA_FIML) {
+      RegisterOutputField("Beta_Fiml",           &CVariable::GetBetaFiml);
+      RegisterOutputField("Production",          &CVariable::GetProduction);
+      RegisterOutputField("Destruction",         &CVariable::GetDestruction);
+      RegisterOutputField("S_Tilde",             &CVariable::GetSTildeSA);
+      RegisterOutputField("Chi",                 &CVariable::GetChiSA);
+      RegisterOutputField("Delta_Criterion",     &CVariable::GetDeltaCriterion);
+      RegisterOutputField("f_w",                 &CVariable::GetFwSA);
+      RegisterOutputField("r",                   &CVariable::GetRSA);
+      RegisterOutputField("Strain_Magnitude",    &CVariable::GetStrainMagnitude);
+      RegisterOutputField("Vorticity_Magnitude", &CVariable::GetVorticityMagnitude);
+      RegisterOutputField("Wall_Distance",       &CVariable::GetWallDist);
+      RegisterOutputField("f_d",                 &CVariable::GetDES_fd);
+      if (config->GetKind_Trans_Model() == BC)
+        RegisterOutputField("Gamma_Trans",       &CVariable::GetGammaTrans);
+      if (config->GetTrainNN())
+        RegisterOutputField("Beta_Fiml_Train",   &CVariable::GetBetaFimlTrain);
+    }
+    
     /*--- Computation of gradients by least squares ---*/
     
     if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
@@ -1459,7 +1436,6 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
 #else
 #endif
     /*--- Restart the solution from file information ---*/
-    ifstream restart_file;
     string filename = config->GetSolution_FlowFileName();
     su2double Density, StaticEnergy, Laminar_Viscosity, nu, nu_hat, muT = 0.0, U[5];
     int Unst_RestartIter;
@@ -1490,163 +1466,84 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
       filename = config->GetUnsteady_FileName(filename, Unst_RestartIter);
     }
     
-    /*--- Open the restart file, throw an error if this fails. ---*/
-    restart_file.open(filename.data(), ios::in);
-    if (restart_file.fail()) {
-      cout << "There is no turbulent restart file!!" << endl;
-      exit(EXIT_FAILURE);
-    }
+    /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
+    Read_SU2_Restart(geometry, config, filename);
 
-    //Moved commented section to above because need to do this for beta_fiml regardless
-    /*--- In case this is a parallel simulation, we need to perform the
-     Global2Local index transformation first. ---*/
-
-    map<unsigned long,unsigned long> Global2Local;
-    map<unsigned long,unsigned long>::const_iterator MI;
-
-    /*--- Now fill array with the transform values only for local points ---*/
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
-    }
+    long iPoint_Local; unsigned long iPoint_Global_Local = 0;
+    unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
 
-    /*--- Read all lines in the restart file ---*/
+    /*--- Position of the turbulence variable and of the FIML training fields
+     (after the coordinates, the flow variables, the flow outputs and the
+     eddy viscosity) in the restart fields of each point:
+     "x"	"y"	"Conservative_1" ... "Pressure"	"Temperature"	"C<sub>p</sub>"	"Mach"	"<greek>m</greek>"
+     "C<sub>f</sub>_x"	"C<sub>f</sub>_y"	"h"	"y<sup>+</sup>"	"<greek>m</greek><sub>t</sub>"
+     "Beta_Fiml"	"Production"	"Destruction"	"S<sub>hat</sub>"	"<greek>X</greek>"	"<greek>d</greek>"	"f<sub>w</sub>"	"r"	"Strain_Mag"	"Vort_Mag"	"wall_dist" ---*/
+
+    unsigned short skipVars = nDim;
+    if (compressible)   skipVars += nDim+2;
+    if (incompressible) skipVars += nDim+1;
+
+    unsigned short fimlVars = skipVars + 11;
+    if (incompressible && (nDim == 2) && (config->GetKind_Trans_Model() != BC)) fimlVars++;
+    bool read_gam = ((config->GetKind_Trans_Model() == BC) || (incompressible && (nDim == 3)));
+
+    for (iPoint_Local = 0; iPoint_Local < (long)nPointDomain; iPoint_Local++) {
+
+      su2double beta_temp = 0.0, Fw_temp = 0.0, delta_temp = 0.0, Prod_temp = 0.0, Dest_temp = 0.0;
+      su2double Chi_temp = 0.0, gam_temp = 0.0, fd_temp = 0.0, S_temp = 0.0, O_temp = 0.0;
+
+      index = iPoint_Local*Restart_Vars;
+      Solution[0] = Restart_Data[index+skipVars];
+
+      if (config->GetTrainNN()) {
+        beta_temp  = Restart_Data[index+fimlVars];
+        Prod_temp  = Restart_Data[index+fimlVars+1];
+        Dest_temp  = Restart_Data[index+fimlVars+2];
+        Chi_temp   = Restart_Data[index+fimlVars+4];
+        delta_temp = Restart_Data[index+fimlVars+5];
+        Fw_temp    = Restart_Data[index+fimlVars+6];
+        S_temp     = Restart_Data[index+fimlVars+8];
+        O_temp     = Restart_Data[index+fimlVars+9];
+        fd_temp    = Restart_Data[index+fimlVars+11];
+        if (read_gam) gam_temp = Restart_Data[index+fimlVars+12];
+      }
 
-    long iPoint_Local; unsigned long iPoint_Global = 0; string text_line; unsigned long iPoint_Global_Local = 0;
-    unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
-    
-    /*--- The first line is the header ---*/
-    
-    getline (restart_file, text_line);
-    
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      
-      getline (restart_file, text_line);
-      
-      istringstream point_line(text_line);
-      
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
-      su2double beta_temp;
-      su2double Fw_temp;
-      su2double delta_temp;
-      su2double Prod_temp;
-      su2double Dest_temp;
-      su2double Chi_temp;
-      su2double gam_temp;
-      su2double fd_temp;
-      su2double S_temp;
-      su2double O_temp;
-      
-      MI = Global2Local.find(iPoint_Global);
-      if (MI != Global2Local.end()) {
-        
-        iPoint_Local = Global2Local[iPoint_Global];
-//        "PointID"	"x"	"y"	"Conservative_1"	"Conservative_2"	"Conservative_3"	"Conservative_4"	"Conservative_5"	"Pressure"
-//"Temperature"	"C<sub>p</sub>"	"Mach"	"<greek>m</greek>"	"C<sub>f</sub>_x"	"C<sub>f</sub>_y"	"h"	"y<sup>+</sup>"	"<greek>m</greek><sub>t</sub>"
-//"Beta_Fiml"	"Production"	"Destruction"	"S<sub>hat</sub>"	"<greek>X</greek>"	"<greek>d</greek>"	"f<sub>w</sub>"	"r"	"Strain_Mag"	"Vort_Mag"	"wall_dist"
-
-        if (compressible) {
-			  if (nDim == 2) {
-				  if (!config->GetTrainNN()) point_line >> index >> dull_val >> dull_val >> U[0] >> U[1] >> U[2] >> U[3] >> Solution[0];
-	           	  else if (config->GetKind_Trans_Model() == BC) {
-	           		  	  	  	  	  	  	 point_line >> index >> dull_val >> dull_val >> U[0] >> U[1] >> U[2] >> U[3] >> Solution[0] >> //1-8
-	            		          		  dull_val >> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> //9-16
-	            		          		  dull_val>> dull_val >> beta_temp >> Prod_temp >> Dest_temp >> dull_val >> Chi_temp >> delta_temp >> //17-24
-	            		          		  Fw_temp >> dull_val >> S_temp >> O_temp >> dull_val >> fd_temp >> gam_temp >> dull_val;
-
-	            	  }
-	            	  else {
-		  	  	  	  	  	  point_line >> index >> dull_val >> dull_val >> U[0] >> U[1] >> U[2] >> U[3] >> Solution[0] >> //1-8
-		          		  dull_val >> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> //9-16
-		          		  dull_val>> dull_val >> beta_temp >> Prod_temp >> Dest_temp >> dull_val >> Chi_temp >> delta_temp >> //17-24
-		          		  Fw_temp >> dull_val >> S_temp >> O_temp >> dull_val >> fd_temp;
-	            	  }
-	          }
-          if (nDim == 3) {
-        	  if (!config->GetTrainNN()) point_line >> index >> dull_val >> dull_val >> dull_val >> U[0] >> U[1] >> U[2] >> U[3] >> U[4] >> Solution[0];
-           	  else if (config->GetKind_Trans_Model() == BC) {
-           		point_line >> index >> dull_val >> dull_val >> dull_val >> U[0] >> U[1] >> U[2] >> U[3] >> U[4] >> Solution[0] >>
-            		          		  dull_val >> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>>
-            		          		  beta_temp >> Prod_temp >> Dest_temp >> dull_val >> Chi_temp >> delta_temp >> Fw_temp >> dull_val >> S_temp >> O_temp >> dull_val >> fd_temp >> gam_temp >> dull_val;
-
-            	  }
-            	  else {
-            		  point_line >> index >> dull_val >> dull_val >> dull_val >> U[0] >> U[1] >> U[2] >> U[3] >> U[4] >> Solution[0] >>
-            		  dull_val >> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>>
-            		  beta_temp >> Prod_temp >> Dest_temp >> dull_val >> Chi_temp >> delta_temp >> Fw_temp >> dull_val >> S_temp >> O_temp >> dull_val >> fd_temp;
-            	  }
-          }
-          Density = U[0];
-          if (nDim == 2)
-            StaticEnergy = U[3]/U[0] - (U[1]*U[1] + U[2]*U[2])/(2.0*U[0]*U[0]);
-          else
-            StaticEnergy = U[4]/U[0] - (U[1]*U[1] + U[2]*U[2] + U[3]*U[3] )/(2.0*U[0]*U[0]);
-
-          FluidModel->SetTDState_rhoe(Density, StaticEnergy);
-          Laminar_Viscosity = FluidModel->GetLaminarViscosity();
-          nu     = Laminar_Viscosity/Density;
-          nu_hat = Solution[0];
-          Ji     = nu_hat/nu;
-          Ji_3   = Ji*Ji*Ji;
-          fv1    = Ji_3/(Ji_3+cv1_3);
-          muT    = Density*fv1*nu_hat;
-          
-        }
-//        "PointID"	"x"	"y"	"Conservative_1"	"Conservative_2"	"Conservative_3"	"Conservative_4"	"Pressure"
-//        "Temperature"	"C<sub>p</sub>"	"Mach"	"<greek>m</greek>"	"C<sub>f</sub>_x"	"C<sub>f</sub>_y"	"h"	"y<sup>+</sup>"	"<greek>m</greek><sub>t</sub>"
-//        "Beta_Fiml"	"Production"	"Destruction"	"S<sub>hat</sub>"	"<greek>X</greek>"	"<greek>d</greek>"	"f<sub>w</sub>"	"r"	"Strain_Mag"	"Vort_Mag"	"wall_dist"
-        if (incompressible) {
-          if (nDim == 2) {
-        	  if (!config->GetTrainNN()) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
-        	  else if (config->GetKind_Trans_Model() == BC) {
-        		  	  	  	  	  	  	 point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0] >> dull_val >> dull_val>> //1-9
-        		  	  	  	  	  	  	 dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val >> //10-17
-        		  	  	  	  	  	  	 beta_temp >> Prod_temp >> Dest_temp >> dull_val >> Chi_temp >> delta_temp >> Fw_temp >> dull_val >>//18-25
-        		  	  	  	  	  	  	 S_temp >> O_temp >> dull_val >> fd_temp >> gam_temp;
-
-        	  }
-        	  else {
-        		  point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0] >>
-        		  dull_val >> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>>
-        		  beta_temp >> Prod_temp >> Dest_temp >> dull_val >> Chi_temp >> delta_temp >> Fw_temp >> dull_val >> S_temp >> O_temp >> dull_val >> fd_temp;
-        	  }
-          }
-          if (nDim == 3) {
-        	  if (!config->GetTrainNN()) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
-           	  else if (config->GetKind_Trans_Model() == BC) {
-           		point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0] >>
-            		          		  dull_val >> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>>
-            		          		  beta_temp >> Prod_temp >> Dest_temp >> dull_val >> Chi_temp >> delta_temp >> Fw_temp >> dull_val >> S_temp >> O_temp >> dull_val >> fd_temp >> gam_temp >> dull_val;
-
-            	  }
-            	  else {
-            		  point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> //8
-            		  Solution[0] >> dull_val >> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>> dull_val>>  //9-16
-            		  dull_val>> dull_val>> dull_val>> beta_temp >> Prod_temp >> Dest_temp >> dull_val >> Chi_temp >> //17-24
-            		  delta_temp >> Fw_temp >> dull_val >> S_temp >> O_temp >> dull_val >> fd_temp >> gam_temp >> dull_val;
-            	  }
-              }
-      	  muT = muT_Inf;
-        }
-        
-        /*--- Instantiate the solution at this node, note that the eddy viscosity should be recomputed ---*/
-        node[iPoint_Local] = new CTurbSAVariable(Solution[0], muT, nDim, nVar, config);
-        //node[iPoint_Local]->SetBetaFiml(config->GetDV_Value(iPoint_Global, 0)+1.0);
-        if (config->GetTrainNN()){
-			node[iPoint_Local]->SetBetaFiml(beta_temp);
-			node[iPoint_Local]->SetProduction(Prod_temp);
-			node[iPoint_Local]->SetDestruction(Dest_temp);
-			node[iPoint_Local]->SetChiSA(Chi_temp);
-			node[iPoint_Local]->SetFwSA(Fw_temp);
-			node[iPoint_Local]->SetDeltaCriterion(delta_temp);
-			node[iPoint_Local]->SetGammaTrans(gam_temp);
-			node[iPoint_Local]->SetDES_fd(fd_temp);
-			node[iPoint_Local]->SetStrainMagnitude(S_temp);
-			node[iPoint_Local]->SetVorticityMagnitude(O_temp);
-        }
-        iPoint_Global_Local++;
+      if (compressible) {
+        for (iVar = 0; iVar < nDim+2; iVar++) U[iVar] = Restart_Data[index+nDim+iVar];
+        Density = U[0];
+        if (nDim == 2)
+          StaticEnergy = U[3]/U[0] - (U[1]*U[1] + U[2]*U[2])/(2.0*U[0]*U[0]);
+        else
+          StaticEnergy = U[4]/U[0] - (U[1]*U[1] + U[2]*U[2] + U[3]*U[3] )/(2.0*U[0]*U[0]);
+
+        FluidModel->SetTDState_rhoe(Density, StaticEnergy);
+        Laminar_Viscosity = FluidModel->GetLaminarViscosity();
+        nu     = Laminar_Viscosity/Density;
+        nu_hat = Solution[0];
+        Ji     = nu_hat/nu;
+        Ji_3   = Ji*Ji*Ji;
+        fv1    = Ji_3/(Ji_3+cv1_3);
+        muT    = Density*fv1*nu_hat;
+      }
+      if (incompressible) {
+        muT = muT_Inf;
       }
 
+      /*--- Instantiate the solution at this node, note that the eddy viscosity should be recomputed ---*/
+      node[iPoint_Local] = new CTurbSAVariable(Solution[0], muT, nDim, nVar, config);
+      if (config->GetTrainNN()){
+        node[iPoint_Local]->SetBetaFiml(beta_temp);
+        node[iPoint_Local]->SetProduction(Prod_temp);
+        node[iPoint_Local]->SetDestruction(Dest_temp);
+        node[iPoint_Local]->SetChiSA(Chi_temp);
+        node[iPoint_Local]->SetFwSA(Fw_temp);
+        node[iPoint_Local]->SetDeltaCriterion(delta_temp);
+        node[iPoint_Local]->SetGammaTrans(gam_temp);
+        node[iPoint_Local]->SetDES_fd(fd_temp);
+        node[iPoint_Local]->SetStrainMagnitude(S_temp);
+        node[iPoint_Local]->SetVorticityMagnitude(O_temp);
+      }
+      iPoint_Global_Local++;
     }
     
     unsigned long nDV_Local = 0;
@@ -1708,8 +1605,8 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
       node[iPoint] = new CTurbSAVariable(Solution[0], muT_Inf, nDim, nVar, config);
     }
     
-    /*--- Close the restart file ---*/
-    restart_file.close();
+    /*--- Delete the class memory that is used to load the restart. ---*/
+    Delete_Restart_Data();
 
   }
   
@@ -4685,7 +4582,6 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
   else {
     
     /*--- Restart the solution from file information ---*/
-    ifstream restart_file;
     string filename = config->GetSolution_FlowFileName();
     
     /*--- Modify file name for multizone problems ---*/
@@ -4705,83 +4601,21 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
     }
 
     
-    /*--- Open the restart file, throw an error if this fails. ---*/
-    restart_file.open(filename.data(), ios::in);
-    if (restart_file.fail()) {
-      cout << "There is no turbulent restart file!!" << endl;
-      exit(EXIT_FAILURE);
-    }
-    
-    /*--- In case this is a parallel simulation, we need to perform the
-     Global2Local index transformation first. ---*/
+    /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
+    Read_SU2_Restart(geometry, config, filename);
 
-    map<unsigned long,unsigned long> Global2Local;
-    map<unsigned long,unsigned long>::const_iterator MI;
-    
-    /*--- Now fill array with the transform values only for local points ---*/
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
-    }
-    
-    /*--- Read all lines in the restart file ---*/
-    long iPoint_Local; unsigned long iPoint_Global = 0; string text_line; unsigned long iPoint_Global_Local = 0;
-    unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
+    /*--- Skip coordinates and flow variables ---*/
+    unsigned short skipVars = nDim;
+    if (compressible)   skipVars += nDim+2;
+    if (incompressible) skipVars += nDim+1;
 
-    /*--- The first line is the header ---*/
-    getline (restart_file, text_line);
-    
-    
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      
-      getline (restart_file, text_line);
-      
-      istringstream point_line(text_line);
-      
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
-      
-      MI = Global2Local.find(iPoint_Global);
-      if (MI != Global2Local.end()) {
-        
-        iPoint_Local = Global2Local[iPoint_Global];
-        
-        if (compressible) {
-          if (nDim == 2) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1];
-          if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1];
-        }
-        if (incompressible) {
-          if (nDim == 2) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1];
-          if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0] >> Solution[1];
-        }
-        
-        /*--- Instantiate the solution at this node, note that the muT_Inf should recomputed ---*/
-        node[iPoint_Local] = new CTurbSSTVariable(Solution[0], Solution[1], muT_Inf, nDim, nVar, constants, config);
-        iPoint_Global_Local++;
-      }
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      index = iPoint*Restart_Vars + skipVars;
+      Solution[0] = Restart_Data[index];
+      Solution[1] = Restart_Data[index+1];
 
-    }
-    
-    /*--- Detect a wrong solution file ---*/
-    
-    if (iPoint_Global_Local < nPointDomain) { sbuf_NotMatching = 1; }
-    
-#ifndef HAVE_MPI
-    rbuf_NotMatching = sbuf_NotMatching;
-#else
-    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
-#endif
-    if (rbuf_NotMatching != 0) {
-      if (rank == MASTER_NODE) {
-        cout << endl << "The solution file " << filename.data() << " doesn't match with the mesh file!" << endl;
-        cout << "It could be empty lines at the end of the file." << endl << endl;
-      }
-#ifndef HAVE_MPI
-      exit(EXIT_FAILURE);
-#else
-      MPI_Barrier(MPI_COMM_WORLD);
-      MPI_Abort(MPI_COMM_WORLD,1);
-      MPI_Finalize();
-#endif
+      /*--- Instantiate the solution at this node, note that the muT_Inf should recomputed ---*/
+      node[iPoint] = new CTurbSSTVariable(Solution[0], Solution[1], muT_Inf, nDim, nVar, constants, config);
     }
 
     /*--- Instantiate the variable class with an arbitrary solution
@@ -4791,8 +4625,8 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
       node[iPoint] = new CTurbSSTVariable(Solution[0], Solution[1], muT_Inf, nDim, nVar, constants, config);
     }
     
-    /*--- Close the restart file ---*/
-    restart_file.close();
+    /*--- Delete the class memory that is used to load the restart. ---*/
+    Delete_Restart_Data();
     
   }
   
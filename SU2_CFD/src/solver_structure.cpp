@@ -68,6 +68,8 @@ CSolver::CSolver(void) {
   Cvector            = NULL;
   node               = NULL;
   nOutputVariables   = 0;
+  Restart_Data       = NULL;
+  Restart_Vars       = 0;
   
 }
 
@@ -167,6 +169,8 @@ CSolver::~CSolver(void) {
     delete [] Cvector;
   }
 
+  if (Restart_Data != NULL) delete [] Restart_Data;
+
 }
 
 void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
@@ -517,8 +521,8 @@ void CSolver::SetAuxVar_Gradient_LS(CGeometry *geometry, CConfig *config) {
 }
 
 void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
-  unsigned long Point = 0, iPoint = 0, jPoint = 0, iEdge, iVertex;
-  unsigned short iVar, iDim, iMarker;
+  unsigned long Point = 0, iPoint = 0, jPoint = 0, iEdge, iEdgeColor, iVertex;
+  unsigned short iVar, iDim, iMarker, iColor;
   su2double *Solution_Vertex, *Solution_i, *Solution_j, Solution_Average, **Gradient, DualArea,
   Partial_Res, Grad_Val, *Normal;
   
@@ -526,22 +530,29 @@ void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
   for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
     node[iPoint]->SetGradientZero();
   
-  /*--- Loop interior edges ---*/
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    Solution_i = node[iPoint]->GetSolution();
-    Solution_j = node[jPoint]->GetSolution();
-    Normal = geometry->edge[iEdge]->GetNormal();
-    for (iVar = 0; iVar< nVar; iVar++) {
-      Solution_Average =  0.5 * (Solution_i[iVar] + Solution_j[iVar]);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Partial_Res = Solution_Average*Normal[iDim];
-        if (geometry->node[iPoint]->GetDomain())
-          node[iPoint]->AddGradient(iVar, iDim, Partial_Res);
-        if (geometry->node[jPoint]->GetDomain())
-          node[jPoint]->SubtractGradient(iVar, iDim, Partial_Res);
+  /*--- Loop interior edges, color by color (the edges of a color do not
+   share points, so they can be split among threads) ---*/
+  for (iColor = 0; iColor < geometry->GetnEdgeColor(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iEdge, iPoint, jPoint, iVar, iDim, Solution_i, Solution_j, Solution_Average, Partial_Res, Normal)
+#endif
+    for (iEdgeColor = 0; iEdgeColor < geometry->GetnEdge_Color(iColor); iEdgeColor++) {
+      iEdge = geometry->GetEdge_Color(iColor, iEdgeColor);
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      
+      Solution_i = node[iPoint]->GetSolution();
+      Solution_j = node[jPoint]->GetSolution();
+      Normal = geometry->edge[iEdge]->GetNormal();
+      for (iVar = 0; iVar< nVar; iVar++) {
+        Solution_Average =  0.5 * (Solution_i[iVar] + Solution_j[iVar]);
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Partial_Res = Solution_Average*Normal[iDim];
+          if (geometry->node[iPoint]->GetDomain())
+            node[iPoint]->AddGradient(iVar, iDim, Partial_Res);
+          if (geometry->node[jPoint]->GetDomain())
+            node[jPoint]->SubtractGradient(iVar, iDim, Partial_Res);
+        }
       }
     }
   }
@@ -1827,6 +1838,286 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 
 }
 
+void CSolver::Read_SU2_Restart(CGeometry *geometry, CConfig *config, string val_filename) {
+  
+  if (config->GetRead_Binary_Restart())
+    Read_SU2_Restart_Binary(geometry, config, val_filename);
+  else
+    Read_SU2_Restart_ASCII(geometry, config, val_filename);
+  
+}
+
+void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, string val_filename) {
+  
+  ifstream restart_file;
+  string text_line, Tag;
+  unsigned short iVar;
+  unsigned long iPoint, index, iPoint_Global, iPoint_Global_Local = 0;
+  unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
+  
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- Open the restart file, and throw an error if this fails. ---*/
+  
+  restart_file.open(val_filename.data(), ios::in);
+  if (restart_file.fail()) {
+    if (rank == MASTER_NODE)
+      cout << "There is no restart file!! " << val_filename.data() << "."<< endl;
+    exit(EXIT_FAILURE);
+  }
+  
+  /*--- The first line is the header, with the "PointID" and one name per
+   field (tab separated), which gives the number of fields per point. ---*/
+  
+  getline (restart_file, text_line);
+  istringstream header_line(text_line);
+  Restart_Vars = 0;
+  while (getline(header_line, Tag, '\t')) Restart_Vars++;
+  if (Restart_Vars > 0) Restart_Vars--;
+  
+  /*--- In case this is a parallel simulation, we need to perform the
+   Global2Local index transformation first. ---*/
+  
+  map<unsigned long,unsigned long> Global2Local;
+  map<unsigned long,unsigned long>::const_iterator MI;
+  
+  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
+    Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
+  
+  if (Restart_Data != NULL) delete [] Restart_Data;
+  Restart_Data = new passivedouble[geometry->GetnPointDomain()*Restart_Vars];
+  for (iPoint = 0; iPoint < geometry->GetnPointDomain()*Restart_Vars; iPoint++)
+    Restart_Data[iPoint] = 0.0;
+  
+  /*--- Read all lines in the restart file, keeping all the fields of the
+   points that live on the current processor. ---*/
+  
+  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+    
+    getline (restart_file, text_line);
+    
+    MI = Global2Local.find(iPoint_Global);
+    if (MI != Global2Local.end()) {
+      
+      istringstream point_line(text_line);
+      iPoint = MI->second;
+      
+      point_line >> index;
+      for (iVar = 0; iVar < Restart_Vars; iVar++)
+        point_line >> Restart_Data[iPoint*Restart_Vars+iVar];
+      
+      iPoint_Global_Local++;
+    }
+    
+  }
+  
+  restart_file.close();
+  
+  /*--- Detect a wrong solution file ---*/
+  
+  if (iPoint_Global_Local < geometry->GetnPointDomain()) { sbuf_NotMatching = 1; }
+  
+#ifndef HAVE_MPI
+  rbuf_NotMatching = sbuf_NotMatching;
+#else
+  SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  if (rbuf_NotMatching != 0) {
+    if (rank == MASTER_NODE) {
+      cout << endl << "The solution file " << val_filename.data() << " doesn't match with the mesh file!" << endl;
+      cout << "It could be empty lines at the end of the file." << endl << endl;
+    }
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+}
+
+void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename) {
+  
+  unsigned short iVar;
+  unsigned long iPoint, nPointDomain_Local = geometry->GetnPointDomain();
+  unsigned short rbuf_NotMatching = 0;
+  int var_buf[5];
+  passivedouble *buf;
+  
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+#ifndef HAVE_MPI
+  
+  /*--- Open the restart file, and throw an error if this fails. ---*/
+  
+  ifstream restart_file(val_filename.data(), ios::in | ios::binary);
+  if (restart_file.fail()) {
+    cout << "There is no restart file!! " << val_filename.data() << "."<< endl;
+    exit(EXIT_FAILURE);
+  }
+  
+  /*--- Header: identifier, number of fields, number of points and length
+   of the metadata (see COutput::SetRestart_Parallel_Binary). ---*/
+  
+  restart_file.read((char *)var_buf, 5*sizeof(int));
+  
+#else
+  
+  MPI_File fhw;
+  MPI_Status status;
+  MPI_Datatype filetype;
+  MPI_Offset disp;
+  
+  int ierr = MPI_File_open(MPI_COMM_WORLD, (char *)val_filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+  if (ierr != MPI_SUCCESS) {
+    if (rank == MASTER_NODE)
+      cout << "There is no restart file!! " << val_filename.data() << "."<< endl;
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+  }
+  
+  MPI_File_read_all(fhw, var_buf, 5, MPI_INT, &status);
+  
+#endif
+  
+  /*--- Detect a wrong solution file (the header is the same on all ranks). ---*/
+  
+  if ((var_buf[0] != SU2_BINARY_RESTART) ||
+      ((unsigned long)var_buf[2] != geometry->GetGlobal_nPointDomain())) rbuf_NotMatching = 1;
+  
+  if (rbuf_NotMatching != 0) {
+    if (rank == MASTER_NODE) {
+      if (var_buf[0] != SU2_BINARY_RESTART)
+        cout << endl << "The file " << val_filename.data() << " is not a binary SU2 restart file!" << endl << endl;
+      else
+        cout << endl << "The solution file " << val_filename.data() << " doesn't match with the mesh file!" << endl << endl;
+    }
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  
+  Restart_Vars = var_buf[1];
+  
+  if (Restart_Data != NULL) delete [] Restart_Data;
+  Restart_Data = new passivedouble[nPointDomain_Local*Restart_Vars];
+  
+#ifndef HAVE_MPI
+  
+  /*--- Skip the variable names and read all the records at once. ---*/
+  
+  restart_file.seekg(Restart_Vars*CGNS_STRING_SIZE, ios::cur);
+  
+  buf = new passivedouble[(unsigned long)var_buf[2]*Restart_Vars];
+  restart_file.read((char *)buf, (unsigned long)var_buf[2]*Restart_Vars*sizeof(passivedouble));
+  restart_file.close();
+  
+  for (iPoint = 0; iPoint < nPointDomain_Local; iPoint++) {
+    unsigned long iPoint_Global = geometry->node[iPoint]->GetGlobalIndex();
+    for (iVar = 0; iVar < Restart_Vars; iVar++)
+      Restart_Data[iPoint*Restart_Vars+iVar] = buf[iPoint_Global*Restart_Vars+iVar];
+  }
+  
+  delete [] buf;
+  
+#else
+  
+  /*--- Each rank only reads the records of its own domain points. The file
+   view must be monotone, so the points are sorted by global index. ---*/
+  
+  vector<pair<unsigned long, unsigned long> > Sorted_Points(nPointDomain_Local);
+  for (iPoint = 0; iPoint < nPointDomain_Local; iPoint++)
+    Sorted_Points[iPoint] = make_pair(geometry->node[iPoint]->GetGlobalIndex(), iPoint);
+  sort(Sorted_Points.begin(), Sorted_Points.end());
+  
+  int *blocklen = new int[nPointDomain_Local];
+  MPI_Aint *displace = new MPI_Aint[nPointDomain_Local];
+  for (iPoint = 0; iPoint < nPointDomain_Local; iPoint++) {
+    blocklen[iPoint] = Restart_Vars;
+    displace[iPoint] = Sorted_Points[iPoint].first*Restart_Vars*sizeof(passivedouble);
+  }
+  
+  MPI_Type_create_hindexed(nPointDomain_Local, blocklen, displace, MPI_DOUBLE, &filetype);
+  MPI_Type_commit(&filetype);
+  
+  disp = 5*sizeof(int) + Restart_Vars*CGNS_STRING_SIZE*sizeof(char);
+  MPI_File_set_view(fhw, disp, MPI_DOUBLE, filetype, (char *)"native", MPI_INFO_NULL);
+  
+  buf = new passivedouble[nPointDomain_Local*Restart_Vars];
+  MPI_File_read_all(fhw, buf, nPointDomain_Local*Restart_Vars, MPI_DOUBLE, &status);
+  
+  MPI_File_close(&fhw);
+  MPI_Type_free(&filetype);
+  
+  for (iPoint = 0; iPoint < nPointDomain_Local; iPoint++)
+    for (iVar = 0; iVar < Restart_Vars; iVar++)
+      Restart_Data[Sorted_Points[iPoint].second*Restart_Vars+iVar] = buf[iPoint*Restart_Vars+iVar];
+  
+  delete [] buf;
+  delete [] blocklen;
+  delete [] displace;
+  
+#endif
+  
+}
+
+string CSolver::Read_SU2_Restart_Metadata(string val_filename) {
+  
+  int var_buf[5];
+  string metadata;
+  
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  ifstream restart_file(val_filename.data(), ios::in | ios::binary);
+  if (restart_file.fail()) {
+    if (rank == MASTER_NODE)
+      cout << "There is no restart file!! " << val_filename.data() << "."<< endl;
+    exit(EXIT_FAILURE);
+  }
+  
+  restart_file.read((char *)var_buf, 5*sizeof(int));
+  if (var_buf[0] != SU2_BINARY_RESTART) {
+    if (rank == MASTER_NODE)
+      cout << endl << "The file " << val_filename.data() << " is not a binary SU2 restart file!" << endl << endl;
+    exit(EXIT_FAILURE);
+  }
+  
+  /*--- The metadata is stored after the names and the records. ---*/
+  
+  restart_file.seekg(5*sizeof(int) + var_buf[1]*CGNS_STRING_SIZE +
+                     (unsigned long)var_buf[2]*var_buf[1]*sizeof(passivedouble));
+  
+  metadata.resize(var_buf[3]);
+  if (var_buf[3] > 0) restart_file.read(&metadata[0], var_buf[3]);
+  restart_file.close();
+  
+  return metadata;
+  
+}
+
+void CSolver::Delete_Restart_Data(void) {
+  
+  if (Restart_Data != NULL) delete [] Restart_Data;
+  Restart_Data = NULL;
+  Restart_Vars = 0;
+  
+}
+
 CBaselineSolver::CBaselineSolver(void) : CSolver() { }
 
 CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned short nVar, vector<string> field_names) {
@@ -78,6 +78,10 @@ def read_plot( filename ):
     
     extension = os.path.splitext( filename )[1]
     
+    # history stream (HISTORY_STREAM= BINARY or JSON)
+    if extension in ['.hist','.jsonl']:
+        return read_history_stream( filename )
+    
     # open history file
     plot_file = open(filename)
     
@@ -135,6 +139,46 @@ def read_plot( filename ):
     return plot_data
 
 
+def read_history_stream( filename ):
+    """ reads a history stream file (HISTORY_STREAM= BINARY or JSON)
+        returns an ordered bunch with the field names for keys
+        and a list of each field's floats for values.
+        the first line holds the schema as json, followed by the
+        records (raw float64 values, or one json array per line).
+    """
+    import json, array
+    
+    stream_file = open(filename,'rb')
+    
+    # schema
+    schema = json.loads( stream_file.readline().decode() )
+    Variables = schema['fields']
+    n_Vars = len(Variables)
+    
+    # records
+    if schema['encoding'] == 'float64':
+        values = array.array('d')
+        data = stream_file.read()
+        data = data[:len(data) - len(data) % (8*n_Vars)]  # drop a partially written record
+        if hasattr(values,'frombytes'): values.frombytes(data)
+        else: values.fromstring(data)
+        if schema['byte_order'] != sys.byteorder: values.byteswap()
+        records = [ values[i:i+n_Vars] for i in range(0,len(values),n_Vars) ]
+    else:
+        records = [ json.loads(line.decode()) for line in stream_file if line.strip() ]
+    
+    stream_file.close()
+    
+    # store to dictionary
+    plot_data = ordered_bunch()
+    for i_Var in range(n_Vars):
+        plot_data[Variables[i_Var]] = [ float(record[i_Var]) for record in records ]
+    
+    return plot_data
+
+#: def read_history_stream()
+
+
 # -------------------------------------------------------------------
 #  Read All Data from History File
 # -------------------------------------------------------------------
@@ -811,6 +855,8 @@ def get_extension(output_format):
     if (output_format == "PARAVIEW")        : return ".vtk"
     if (output_format == "TECPLOT")         : return ".dat"
     if (output_format == "TECPLOT_BINARY")  : return ".plt"
+    if (output_format == "BINARY")          : return ".hist"
+    if (output_format == "JSON")            : return ".jsonl"
     if (output_format == "SOLUTION")        : return ".dat"  
     if (output_format == "RESTART")         : return ".dat"  
     if (output_format == "CONFIG")          : return ".cfg"  
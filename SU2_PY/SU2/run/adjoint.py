@@ -90,6 +90,8 @@ def adjoint( config ):
     
     # filenames
     plot_format      = konfig['OUTPUT_FORMAT']
+    if konfig.get('HISTORY_STREAM','NONE') != 'NONE':
+        plot_format  = konfig['HISTORY_STREAM']
     plot_extension   = su2io.get_extension(plot_format)
     history_filename = konfig['CONV_FILENAME'] + plot_extension
     special_cases    = su2io.get_specialCases(konfig)